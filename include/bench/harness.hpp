@@ -0,0 +1,60 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Runs `iterations` operations back to back.
+using BenchBody = std::function<void(uint64_t iterations)>;
+// Builds the state a benchmark needs and returns its body. Only called for
+// benchmarks that pass the filter, and never timed.
+using BenchSetup = std::function<BenchBody()>;
+
+struct BenchOptions {
+    std::string filter;                              // substring of the name, empty = all
+    std::chrono::milliseconds min_time{100};         // per repetition
+    int repetitions = 5;
+    bool json = false;                               // one JSON object per line
+};
+
+struct BenchResult {
+    std::string name;
+    uint64_t iterations = 0;                         // per repetition
+    double min_ns = 0.0;                             // per operation
+    double median_ns = 0.0;
+    double max_ns = 0.0;
+    std::string warning;                             // set by benchWarn(), result is suspect
+};
+
+class BenchRegistry {
+public:
+    void add(const std::string& name, BenchSetup setup);
+
+    // Sizes each benchmark so a repetition takes at least min_time, then
+    // reports the per-operation time across repetitions.
+    std::vector<BenchResult> run(const BenchOptions& options) const;
+
+private:
+    struct Entry {
+        std::string name;
+        BenchSetup setup;
+    };
+
+    std::vector<Entry> entries;
+};
+
+// Flags the running benchmark's result as not measuring what it claims
+// (e.g. operations that were dropped rather than performed). bench exits
+// with a non-zero status if any result carries a warning.
+void benchWarn(const std::string& message);
+
+// Keeps the compiler from discarding a computed value.
+template <typename T>
+inline void benchKeep(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+void registerGeneticBenchmarks(BenchRegistry& registry);
+void registerSensorBenchmarks(BenchRegistry& registry);
+void registerLoopBenchmarks(BenchRegistry& registry);
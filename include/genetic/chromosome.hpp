@@ -1,5 +1,7 @@
 #pragma once
 #include "utils/data_types.hpp"
+#include <array>
+#include <cstddef>
 #include <vector>
 
 struct OptimizationParams {
@@ -8,14 +10,34 @@ struct OptimizationParams {
     double power_threshold;
 };
 
+// Search range for each threshold (percent, percent, watts).
+struct OptimizationBounds {
+    OptimizationParams lower{5.0, 5.0, 0.5};
+    OptimizationParams upper{100.0, 100.0, 15.0};
+};
+
+// Gene view of OptimizationParams, in declaration order.
+constexpr size_t kGeneCount = 3;
+using GeneArray = std::array<double, kGeneCount>;
+
+inline GeneArray toGenes(const OptimizationParams& params) {
+    return {params.cpu_threshold, params.memory_threshold, params.power_threshold};
+}
+
+inline OptimizationParams fromGenes(const GeneArray& genes) {
+    return {genes[0], genes[1], genes[2]};
+}
+
 class Chromosome {
 public:
     Chromosome();
+    explicit Chromosome(const OptimizationParams& params, double fitness = 0.0);
     void calculateFitness(const SystemResources& current);
     OptimizationParams getParams() const;
+    void setParams(const OptimizationParams& newParams);
     double getFitness() const;
-    
+
 private:
     OptimizationParams params;
     double fitness;
-};
\ No newline at end of file
+};
@@ -1,10 +1,21 @@
 #pragma once
 #include "chromosome.hpp"
+#include "rng.hpp"
 
 class Crossover {
 public:
-    static std::pair<Chromosome, Chromosome> crossover(
-        const Chromosome& parent1, 
-        const Chromosome& parent2
+    // Blend crossover: both children are the same random convex combination
+    // of the parents, mirrored.
+    static void crossover(
+        const Chromosome& parent1,
+        const Chromosome& parent2,
+        Chromosome& child1,
+        Chromosome& child2,
+        CounterRng& rng
     );
-};
\ No newline at end of file
+
+    static void blend(double gene1, double gene2, double alpha, double& child1, double& child2) {
+        child1 = alpha * gene1 + (1.0 - alpha) * gene2;
+        child2 = alpha * gene2 + (1.0 - alpha) * gene1;
+    }
+};
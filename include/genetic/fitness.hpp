@@ -1,11 +1,34 @@
 #pragma once
 #include "chromosome.hpp"
 #include "utils/data_types.hpp"
+#include <cstddef>
 
+// Scores how well a set of thresholds fits the current load: each threshold
+// should sit a fixed headroom above the measured usage, and thresholds below
+// the usage (which would throttle constantly) are penalised harder. When the
+// SoC runs hot or is being throttled, the CPU and power targets shift below
+// the current usage so that backing off scores best.
+// Scores are in (0, 1], higher is better.
 class FitnessEvaluator {
 public:
     static double evaluate(
-        const Chromosome& chromosome, 
+        const Chromosome& chromosome,
         const SystemResources& resources
     );
-};
\ No newline at end of file
+
+    static double evaluate(
+        const OptimizationParams& params,
+        const SystemResources& resources
+    );
+
+    // Scores `count` individuals stored as structure-of-arrays. The loop is
+    // branch-free so the compiler can vectorise it.
+    static void evaluateBatch(
+        const double* cpuThresholds,
+        const double* memoryThresholds,
+        const double* powerThresholds,
+        double* fitness,
+        size_t count,
+        const SystemResources& resources
+    );
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include "chromosome.hpp"
+#include "utils/data_types.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Direct-mapped cache of fitness scores keyed by the exact parameter vector
+// and the resource sample quantised to `bucketWidth`. Readings that land in
+// the same bucket reuse the score. Storage is allocated once; colliding keys
+// simply overwrite each other.
+class FitnessCache {
+public:
+    FitnessCache(size_t capacity, double bucketWidth);
+
+    // Selects the bucket that subsequent lookups and inserts refer to.
+    void setResources(const SystemResources& resources);
+
+    bool lookup(const GeneArray& genes, double& fitness);
+    void insert(const GeneArray& genes, double fitness);
+    void clear();
+
+    uint64_t hits() const { return hitCount; }
+    uint64_t misses() const { return missCount; }
+
+private:
+    struct Entry {
+        GeneArray genes;
+        std::array<int32_t, 5> bucket;
+        double fitness;
+        bool valid;
+    };
+
+    size_t slotFor(const GeneArray& genes) const;
+
+    std::vector<Entry> entries;
+    size_t mask;
+    double bucketWidth;
+    std::array<int32_t, 5> bucket{};
+    uint64_t bucketHash = 0;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+};
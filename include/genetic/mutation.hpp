@@ -1,7 +1,25 @@
 #pragma once
 #include "chromosome.hpp"
+#include "rng.hpp"
 
 class Mutation {
 public:
-    static void mutate(Chromosome& chromosome, double mutationRate);
-};
\ No newline at end of file
+    // Each gene is perturbed with probability `mutationRate` by Gaussian noise
+    // whose standard deviation is `sigma` times the gene's range.
+    static void mutate(
+        Chromosome& chromosome,
+        double mutationRate,
+        CounterRng& rng,
+        const OptimizationBounds& bounds = OptimizationBounds{},
+        double sigma = 0.05
+    );
+
+    static double mutateGene(double gene, double lower, double upper,
+                             double mutationRate, double sigma, CounterRng& rng) {
+        if (rng.uniform() >= mutationRate) {
+            return gene;
+        }
+        double mutated = gene + rng.normal() * sigma * (upper - lower);
+        return mutated < lower ? lower : (mutated > upper ? upper : mutated);
+    }
+};
@@ -1,13 +1,102 @@
 #pragma once
 #include "chromosome.hpp"
+#include "fitness_cache.hpp"
+#include "rng.hpp"
+#include "utils/data_types.hpp"
+#include "utils/worker_pool.hpp"
+#include <array>
+#include <cstdint>
 #include <vector>
 
+enum class EvolutionMode {
+    Generational,   // breed and re-score the whole population every call
+    SteadyState,    // re-score the elites and a small batch of offspring
+};
+
+struct GeneticConfig {
+    size_t elite_count = 2;
+    size_t tournament_size = 3;
+    double crossover_rate = 0.9;
+    double mutation_rate = 0.1;
+    double mutation_sigma = 0.05;   // fraction of each gene's range
+    OptimizationBounds bounds;
+    uint64_t seed = 0x455241ull;
+    unsigned threads = 0;           // 0 = hardware_concurrency()
+
+    EvolutionMode mode = EvolutionMode::Generational;
+    size_t steady_state_offspring = 64;
+    // Per-channel moves below these keep the elite scores.
+    double cpu_epsilon = 1.0;           // % CPU
+    double memory_epsilon = 0.5;        // % memory
+    double power_epsilon = 0.1;         // W
+    double temperature_epsilon = 0.5;   // °C
+    // Optional FitnessCache for elite re-scoring; 0 disables it. Offspring
+    // never go through it: they are fresh continuous gene vectors that do
+    // not repeat. A lookup costs about as much as an evaluation, and with
+    // load that keeps moving the elite set churns too (a few percent hits),
+    // so it is not a CPU saving. It only pays off when the elites are stable
+    // and the load keeps returning to the same buckets.
+    double cache_bucket_width = 1.0;    // resource quantisation for FitnessCache
+    size_t fitness_cache_size = 0;
+};
+
+// Genes and fitness live in structure-of-arrays buffers sized once at
+// construction. Each generation is bred from one buffer into the other and
+// the two are swapped, so evolve() does not allocate. Fitness evaluation and
+// breeding run across a WorkerPool; every individual draws from its own
+// CounterRng stream, so a given seed yields the same run on any core count.
+//
+// In SteadyState mode the population is kept across calls and warm-starts
+// every tick: only the elites are re-scored (and only when a reading moved by
+// more than its channel's epsilon), a small batch of offspring is bred and
+// scored, and each offspring replaces the loser of an inverse tournament if it
+// scores better. The warm start waits for the first evolve(current); calls to
+// evolve() before that are no-ops.
 class Population {
 public:
     Population(size_t size);
+    Population(size_t size, const GeneticConfig& config);
+
+    // Advances one generation scored against `current`.
+    void evolve(const SystemResources& current);
+    // Advances one generation against the last resources passed in. In
+    // SteadyState mode this does nothing until evolve(current) has been called.
     void evolve();
+
     Chromosome getBestChromosome() const;
-    
+    size_t size() const { return populationSize; }
+    uint64_t getGeneration() const { return generation; }
+    // Fitness computations actually performed, excluding cache hits.
+    uint64_t getEvaluationCount() const { return evaluations; }
+    const FitnessCache& getFitnessCache() const { return cache; }
+
 private:
-    std::vector<Chromosome> chromosomes;
-};
\ No newline at end of file
+    struct Generation {
+        std::array<std::vector<double>, kGeneCount> genes;
+        std::vector<double> fitness;
+    };
+
+    void evaluate(Generation& target);
+    void selectElites(const Generation& source);
+    size_t tournament(const Generation& source, CounterRng& rng) const;
+    void breed(const Generation& source, Generation& target, size_t firstPair, size_t lastPair);
+    void steadyStateStep();
+    double scoreCached(const GeneArray& genes);
+    bool resourcesChanged() const;
+    bool resourcesMoved() const;
+    void offerElite(size_t index, const std::vector<double>& fitness);
+
+    GeneticConfig config;
+    size_t populationSize;
+    std::array<Generation, 2> buffers;
+    size_t currentBuffer = 0;
+    std::vector<size_t> elites;
+    size_t bestIndex = 0;
+    SystemResources resources{};
+    SystemResources scoredResources{};
+    bool haveResources = false;
+    uint64_t generation = 0;
+    uint64_t evaluations = 0;
+    FitnessCache cache;
+    WorkerPool pool;
+};
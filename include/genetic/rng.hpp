@@ -0,0 +1,43 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Counter-based generator: each value is a pure function of (key, counter),
+// so the GA derives one stream per individual and generation. Results are
+// therefore identical no matter how the work is split across threads.
+class CounterRng {
+public:
+    CounterRng(uint64_t seed, uint64_t stream) : key(mix(seed ^ mix(stream))) {}
+
+    uint64_t next() {
+        return mix(key + (++counter) * 0x9E3779B97F4A7C15ull);
+    }
+
+    // Uniform in [0, 1).
+    double uniform() {
+        return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // Uniform integer in [0, bound) for bound < 2^32.
+    size_t below(size_t bound) {
+        return static_cast<size_t>(((next() >> 32) * static_cast<uint64_t>(bound)) >> 32);
+    }
+
+    // Standard normal (Box-Muller).
+    double normal() {
+        double u1 = 1.0 - uniform();
+        double u2 = uniform();
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+    }
+
+    static uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+private:
+    uint64_t key;
+    uint64_t counter = 0;
+};
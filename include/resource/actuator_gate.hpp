@@ -0,0 +1,58 @@
+#pragma once
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+struct ActuatorLimits {
+    double hysteresis;                        // smallest change worth applying
+    std::chrono::milliseconds min_interval;   // shortest time between changes
+    bool rise_immediately = false;            // increases skip hysteresis and interval
+    double max_step_down = 0.0;               // largest decrease per change, 0 = any
+};
+
+// Hysteresis and rate limiting for one set point. A target is admitted when
+// it is at least `hysteresis` away from the applied one and `min_interval`
+// has passed since the last change. The first target is always admitted.
+// For caps that throttle a workload, `rise_immediately` lets demand raise
+// the cap at once while `max_step_down` makes it come down gradually.
+// After a successful admit(), applied() holds the value to act on.
+class ActuatorGate {
+public:
+    explicit ActuatorGate(const ActuatorLimits& limits)
+        : hysteresis(limits.hysteresis),
+          riseImmediately(limits.rise_immediately),
+          maxStepDown(limits.max_step_down),
+          minIntervalNs(static_cast<uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(limits.min_interval).count())) {}
+
+    bool admit(double target, uint64_t nowNs) {
+        if (hasValue) {
+            bool rising = riseImmediately && target > value;
+            if (!rising && (std::fabs(target - value) < hysteresis || nowNs - changedNs < minIntervalNs)) {
+                ++suppressedCount;
+                return false;
+            }
+            if (maxStepDown > 0.0 && target < value - maxStepDown) {
+                target = value - maxStepDown;
+            }
+        }
+        value = target;
+        changedNs = nowNs;
+        hasValue = true;
+        return true;
+    }
+
+    bool hasApplied() const { return hasValue; }
+    double applied() const { return value; }
+    uint64_t suppressed() const { return suppressedCount; }
+
+private:
+    double hysteresis;
+    bool riseImmediately;
+    double maxStepDown;
+    uint64_t minIntervalNs;
+    double value = 0.0;
+    uint64_t changedNs = 0;
+    bool hasValue = false;
+    uint64_t suppressedCount = 0;
+};
@@ -1,7 +1,43 @@
 #pragma once
+#include "resource/pressure_reader.hpp"
+#include "utils/proc_file.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
 
+// Samples /proc/stat and /proc/pressure/cpu. Utilisation is computed from the
+// jiffy deltas between consecutive samples, overall and per core.
 class CPUMonitor {
 public:
+    explicit CPUMonitor(const std::string& procRoot = "/proc");
+
+    // Overall utilisation in percent since the previous call.
     virtual double getCurrentUsage();
+    // False until a call has covered an interval in which the jiffy
+    // counters advanced; before that getCurrentUsage() reads 0%.
+    bool hasSample() const { return sampled; }
     virtual ~CPUMonitor() = default;
+
+    size_t coreCount() const { return coreUsage.size(); }
+    // Per-core utilisation in percent as of the last getCurrentUsage() call.
+    double getCoreUsage(size_t core) const { return coreUsage[core]; }
+    const PressureStats& getPressure() const { return pressure; }
+
+private:
+    struct Jiffies {
+        uint64_t busy = 0;
+        uint64_t total = 0;
+    };
+
+    bool sample();
+
+    ProcFile statFile;
+    PressureReader pressureReader;
+    std::vector<char> buffer;
+    Jiffies lastTotal;
+    std::vector<Jiffies> lastCore;
+    std::vector<double> coreUsage;
+    double usage = 0.0;
+    bool sampled = false;
+    PressureStats pressure;
 };
@@ -1,8 +1,34 @@
 #pragma once
+#include "resource/actuator_gate.hpp"
+#include "utils/sysfs_writer.hpp"
+#include <string>
 
+// Limits the managed cgroup (cgroup v2) to `threshold` percent of the
+// machine's CPU time: cpuset.cpus pins it to just enough cores, taken from
+// the top so cpu0 (IRQs, housekeeping) is the last one used, and cpu.max
+// sets the matching bandwidth quota. By default the cap rises as soon as
+// the target does and comes down at most 10 points per 5 s, so it never
+// holds back demand for long. Attributes the cgroup does not expose are
+// left alone.
 class CPUOptimizer {
 public:
+    explicit CPUOptimizer(const std::string& cgroupDir,
+                          const std::string& sysRoot = "/sys",
+                          const ActuatorLimits& limits = {2.0, std::chrono::seconds(5), true, 10.0});
+
     virtual void optimize(double threshold);
     virtual ~CPUOptimizer() = default;
-};
 
+    size_t coreCount() const { return cores; }
+    bool hasQuota() const { return cpuMax >= 0; }
+    bool hasCpuset() const { return cpusetCpus >= 0; }
+    const ActuatorGate& getGate() const { return gate; }
+    const SysfsWriter& getWriter() const { return writer; }
+
+private:
+    SysfsWriter writer;
+    ActuatorGate gate;
+    size_t cores;
+    int cpuMax;
+    int cpusetCpus;
+};
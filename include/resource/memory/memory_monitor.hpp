@@ -1,7 +1,34 @@
 #pragma once
+#include "resource/pressure_reader.hpp"
+#include "utils/proc_file.hpp"
+#include <cstdint>
+#include <string>
 
+struct MemoryStats {
+    uint64_t total_kb = 0;
+    uint64_t available_kb = 0;
+    uint64_t swap_total_kb = 0;
+    uint64_t swap_free_kb = 0;
+    PressureStats pressure;
+};
+
+// Samples /proc/meminfo and /proc/pressure/memory.
 class MemoryMonitor {
 public:
+    explicit MemoryMonitor(const std::string& procRoot = "/proc");
+
+    // Share of MemTotal that is not MemAvailable, in percent.
     virtual double getCurrentUsage();
     virtual ~MemoryMonitor() = default;
-};
\ No newline at end of file
+
+    // Values as of the last getCurrentUsage() call.
+    const MemoryStats& getStats() const { return stats; }
+
+private:
+    bool sample();
+
+    ProcFile meminfoFile;
+    PressureReader pressureReader;
+    MemoryStats stats;
+    double usage = 0.0;
+};
@@ -1,7 +1,30 @@
 #pragma once
+#include "resource/actuator_gate.hpp"
+#include "utils/sysfs_writer.hpp"
+#include <cstdint>
+#include <string>
 
+// Sets memory.high of the managed cgroup (cgroup v2) to `threshold` percent
+// of MemTotal, so the kernel reclaims from it before the system as a whole
+// runs short. 100 percent removes the limit. Like the CPU cap, the limit
+// rises at once and comes down gradually by default.
 class MemoryOptimizer {
 public:
+    explicit MemoryOptimizer(const std::string& cgroupDir,
+                             const std::string& procRoot = "/proc",
+                             const ActuatorLimits& limits = {2.0, std::chrono::seconds(5), true, 10.0});
+
     virtual void optimize(double threshold);
     virtual ~MemoryOptimizer() = default;
-};
\ No newline at end of file
+
+    uint64_t totalBytes() const { return total; }
+    bool isAttached() const { return memoryHigh >= 0; }
+    const ActuatorGate& getGate() const { return gate; }
+    const SysfsWriter& getWriter() const { return writer; }
+
+private:
+    SysfsWriter writer;
+    ActuatorGate gate;
+    uint64_t total = 0;
+    int memoryHigh;
+};
@@ -1,7 +1,39 @@
 #pragma once
+#include "utils/proc_file.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
 
+// Sums power draw over the sensors found under <sysRoot>/class/hwmon and
+// <sysRoot>/class/power_supply. Cumulative energy counters are preferred
+// and turned into average watts over the sampling interval; otherwise
+// instantaneous power or voltage * current is used.
 class PowerMonitor {
 public:
+    explicit PowerMonitor(const std::string& sysRoot = "/sys");
+
+    // Total power in watts.
     virtual double getCurrentUsage();
     virtual ~PowerMonitor() = default;
+
+    size_t sourceCount() const { return sources.size(); }
+
+private:
+    enum class SourceKind { Energy, Power, VoltageCurrent };
+
+    struct Source {
+        SourceKind kind;
+        ProcFile primary;     // energy or power, or voltage
+        ProcFile secondary;   // current for VoltageCurrent
+        double scale;         // converts the raw reading to joules or watts
+        int64_t lastEnergy = 0;
+        uint64_t lastSampleNs = 0;
+        double watts = 0.0;
+    };
+
+    void addHwmon(const std::string& dir);
+    void addPowerSupply(const std::string& dir);
+    void sample(Source& source);
+
+    std::vector<Source> sources;
 };
@@ -1,7 +1,60 @@
 #pragma once
+#include "resource/actuator_gate.hpp"
+#include "utils/sysfs_writer.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
 
+struct PowerOptimizerConfig {
+    bool enabled = false;                           // cpufreq is system-wide, so opt-in
+    double max_power_watts = 0.0;                   // draw at full clock; 0 = peak seen by observePower()
+    double low_power_watts = 3.0;                   // below this, ramp clocks up slowly
+    std::string governor = "schedutil";
+    std::string low_power_governor = "conservative";
+    std::string fallback_governor = "ondemand";
+};
+
+// Turns a power budget in watts into cpufreq settings for every policy under
+// <sysRoot>/devices/system/cpu/cpufreq: scaling_max_freq scales linearly
+// with the budget (snapped to an available frequency) and small budgets
+// switch to a slower-ramping governor. Governors the kernel does not offer
+// are skipped. This changes clocks for the whole system, not just the
+// managed cgroup, so nothing is written unless `enabled` is set and the
+// full-clock draw is known, either configured or observed.
 class PowerOptimizer {
 public:
+    explicit PowerOptimizer(const std::string& sysRoot = "/sys",
+                            const PowerOptimizerConfig& config = PowerOptimizerConfig(),
+                            const ActuatorLimits& limits = {0.5, std::chrono::seconds(5)});
+
     virtual void optimize(double threshold);
     virtual ~PowerOptimizer() = default;
-};
\ No newline at end of file
+
+    // Feeds a measured draw; the highest seen stands in for max_power_watts
+    // when that is not configured.
+    void observePower(double watts);
+    // Draw that maps to the top of the clock range, 0 while unknown.
+    double fullPowerWatts() const;
+
+    size_t policyCount() const { return policies.size(); }
+    const ActuatorGate& getGate() const { return gate; }
+    const SysfsWriter& getWriter() const { return writer; }
+
+private:
+    struct Policy {
+        int maxFreq;
+        int governor;
+        uint64_t minKhz;
+        uint64_t maxKhz;
+        std::vector<uint64_t> available;   // ascending, may be empty
+        std::string availableGovernors;
+    };
+
+    const char* pickGovernor(const Policy& policy, double watts) const;
+
+    PowerOptimizerConfig config;
+    SysfsWriter writer;
+    ActuatorGate gate;
+    std::vector<Policy> policies;
+    double peakWatts = 0.0;
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include "utils/proc_file.hpp"
+#include <cstdint>
+#include <string>
+
+struct PressureStats {
+    double some_avg10 = 0.0;       // kernel's 10 s average, percent
+    double full_avg10 = 0.0;
+    double some_stall_pct = 0.0;   // share of the last sampling interval, percent
+    double full_stall_pct = 0.0;
+};
+
+// Reads a /proc/pressure/* file. The stall percentages come from the
+// cumulative total= counters, so they cover exactly the time between two
+// samples instead of the kernel's fixed averaging windows.
+class PressureReader {
+public:
+    PressureReader() = default;
+    explicit PressureReader(const std::string& path);
+
+    bool available() const { return file.isOpen(); }
+    bool sample(PressureStats& stats);
+
+private:
+    ProcFile file;
+    uint64_t lastSomeUs = 0;
+    uint64_t lastFullUs = 0;
+    uint64_t lastSampleNs = 0;
+};
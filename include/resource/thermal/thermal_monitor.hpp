@@ -0,0 +1,21 @@
+#pragma once
+#include "utils/data_types.hpp"
+#include "utils/proc_file.hpp"
+#include <string>
+
+// Reads the SoC temperature from <sysRoot>/class/thermal/thermal_zone0 and,
+// on a Raspberry Pi, the firmware throttling flags. Without those flags a
+// temperature at or above `throttleCelsius` counts as throttled.
+class ThermalMonitor {
+public:
+    explicit ThermalMonitor(const std::string& sysRoot = "/sys", double throttleCelsius = 80.0);
+
+    virtual ThermalState getCurrentState();
+    virtual ~ThermalMonitor() = default;
+
+private:
+    ProcFile zoneTemp;
+    ProcFile throttledFlags;
+    double throttleCelsius;
+    ThermalState state{0.0, false};
+};
@@ -1,8 +1,37 @@
 #pragma once
+#include "sensors/camera/capture_backend.hpp"
+#include "sensors/camera/frame_pool.hpp"
 #include "utils/data_types.hpp"
+#include <cstdint>
+#include <memory>
 
+struct CaptureStats {
+    uint64_t delivered = 0;
+    uint64_t dropped = 0;
+};
+
+// Delivers frames from a fixed pool of buffers. Consumers get FrameViews
+// that point straight at the pooled pixels; when all buffers are still held
+// the new frame is dropped and counted rather than waiting for a buffer.
 class CameraCapture {
 public:
+    explicit CameraCapture(const CameraConfig& config = CameraConfig{});
+
+    // Captures a frame and returns its metadata only; the buffer is released
+    // immediately. Returns a zero-sized frame if nothing was delivered.
     virtual CameraFrame captureFrame();
+    // Returns an empty view if the frame was dropped or capture failed.
+    virtual FrameView acquireFrame();
     virtual ~CameraCapture() = default;
-};
\ No newline at end of file
+
+    bool isOpen() const { return open; }
+    const CameraConfig& getConfig() const { return config; }
+    const CaptureStats& getStats() const { return stats; }
+
+private:
+    CameraConfig config;
+    std::unique_ptr<CaptureBackend> backend;
+    FramePool pool;
+    CaptureStats stats;
+    bool open = false;
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include "sensors/camera/frame_pool.hpp"
+#include "utils/data_types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+constexpr uint32_t cameraFourcc(char a, char b, char c, char d) {
+    return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) |
+           (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24);
+}
+
+enum class CameraBackend {
+    Auto,        // V4L2 if `device` exists, otherwise Synthetic
+    Synthetic,   // generated test pattern, no device needed
+    File,        // raw frames read back to back from a file, looping
+    V4L2,        // mmap'd driver buffers from a video device
+};
+
+struct CameraConfig {
+    CameraBackend backend = CameraBackend::Auto;
+    std::string device = "/dev/video0";
+    std::string file;
+    int width = 640;
+    int height = 480;
+    uint32_t pixel_format = cameraFourcc('G', 'R', 'E', 'Y');
+    int bytes_per_pixel = 1;
+    size_t buffer_count = 4;
+    int timeout_ms = 1000;
+};
+
+// Produces frames into a FramePool. Backends either fill pool-allocated
+// buffers in place or adopt the driver's buffers, so no frame is copied
+// on its way to consumers.
+class CaptureBackend : public FrameRecycler {
+public:
+    // Sets up the pool's buffers; may adjust config to what the device accepted.
+    virtual bool start(CameraConfig& config, FramePool& pool) = 0;
+
+    // Captures the next frame into a claimed slot and returns its index, or
+    // -1 if nothing was delivered. `dropped` is increased by every frame lost,
+    // including the current one when all slots are held by consumers.
+    virtual int32_t capture(FramePool& pool, CameraFrame& info, uint64_t& dropped) = 0;
+
+    void recycle(uint32_t) override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include "sensors/camera/capture_backend.hpp"
+
+// Replays raw frames of width * height * bytes_per_pixel bytes stored back
+// to back in config.file, starting over at the end of the file.
+class FileBackend : public CaptureBackend {
+public:
+    ~FileBackend() override;
+
+    bool start(CameraConfig& config, FramePool& pool) override;
+    int32_t capture(FramePool& pool, CameraFrame& info, uint64_t& dropped) override;
+
+private:
+    CameraConfig config;
+    int fd = -1;
+    size_t frameBytes = 0;
+    size_t frameCount = 0;
+    uint64_t sequence = 0;
+};
@@ -0,0 +1,89 @@
+#pragma once
+#include "utils/data_types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+class FramePool;
+
+// Notified when the last view of a frame goes away, e.g. to hand an mmap'd
+// buffer back to the driver.
+class FrameRecycler {
+public:
+    virtual void recycle(uint32_t index) = 0;
+    virtual ~FrameRecycler() = default;
+};
+
+// Reference-counted, read-only handle to a pooled frame. Copying a view
+// shares the pixels; the buffer returns to the pool when the last view is
+// destroyed. Views must not outlive the CameraCapture they came from.
+class FrameView {
+public:
+    FrameView() = default;
+    FrameView(const FrameView& other);
+    FrameView(FrameView&& other) noexcept;
+    FrameView& operator=(FrameView other) noexcept;
+    ~FrameView();
+
+    explicit operator bool() const { return pool != nullptr; }
+    const uint8_t* data() const;
+    size_t size() const;
+    const CameraFrame& info() const;
+
+private:
+    friend class FramePool;
+    FrameView(FramePool* pool, uint32_t index) : pool(pool), index(index) {}
+
+    FramePool* pool = nullptr;
+    uint32_t index = 0;
+};
+
+// Fixed set of frame buffers, either allocated here or adopted from a
+// capture backend (mmap'd driver buffers). A slot's reference count is 0
+// while it is free, so acquiring and releasing never lock or allocate.
+class FramePool {
+public:
+    explicit FramePool(FrameRecycler* recycler = nullptr) : recycler(recycler) {}
+    ~FramePool();
+
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    // Allocates `count` cache-line aligned buffers of `bytes` each.
+    void allocate(size_t count, size_t bytes);
+    // Uses externally owned buffers; the pool never frees them.
+    void adopt(size_t count, uint8_t* const* buffers, size_t bytes);
+
+    // Claims a free slot for filling. Returns -1 when every slot is in use.
+    int32_t tryAcquire();
+    // Marks a slot as held by the producer without checking that it is free,
+    // for backends that track buffer ownership themselves.
+    void claim(uint32_t index);
+    // Hands a filled, claimed slot to consumers.
+    FrameView publish(uint32_t index, const CameraFrame& info);
+    // Gives a claimed slot back without publishing it.
+    void abandon(uint32_t index) { release(index); }
+
+    size_t size() const { return count; }
+    size_t bufferBytes() const { return bytes; }
+    uint8_t* buffer(uint32_t index) { return slots[index].data; }
+
+private:
+    friend class FrameView;
+
+    struct Slot {
+        uint8_t* data = nullptr;
+        CameraFrame info;
+        std::atomic<uint32_t> refs{0};
+    };
+
+    void retain(uint32_t index);
+    void release(uint32_t index);
+
+    FrameRecycler* recycler;
+    std::unique_ptr<Slot[]> slots;
+    size_t count = 0;
+    size_t bytes = 0;
+    bool owned = false;
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include "sensors/camera/capture_backend.hpp"
+
+// Draws a horizontal-band pattern that scrolls by one row per frame.
+class SyntheticBackend : public CaptureBackend {
+public:
+    bool start(CameraConfig& config, FramePool& pool) override;
+    int32_t capture(FramePool& pool, CameraFrame& info, uint64_t& dropped) override;
+
+private:
+    CameraConfig config;
+    uint64_t sequence = 0;
+};
@@ -0,0 +1,28 @@
+#pragma once
+#include "sensors/camera/capture_backend.hpp"
+#include <vector>
+
+// Streams from a V4L2 capture device with memory-mapped buffers. The pool
+// adopts the mappings directly; a buffer is queued back to the driver when
+// its last FrameView is released.
+class V4L2Backend : public CaptureBackend {
+public:
+    ~V4L2Backend() override;
+
+    bool start(CameraConfig& config, FramePool& pool) override;
+    int32_t capture(FramePool& pool, CameraFrame& info, uint64_t& dropped) override;
+    void recycle(uint32_t index) override;
+
+private:
+    struct Mapping {
+        uint8_t* data;
+        size_t length;
+    };
+
+    CameraConfig config;
+    int fd = -1;
+    std::vector<Mapping> mappings;
+    bool streaming = false;
+    bool haveSequence = false;
+    uint32_t lastSequence = 0;
+};
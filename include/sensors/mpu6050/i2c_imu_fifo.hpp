@@ -0,0 +1,30 @@
+#pragma once
+#include "sensors/mpu6050/imu_fifo.hpp"
+#include <cstdint>
+#include <string>
+
+// MPU6050 on a Linux i2c-dev bus. open() configures the sample rate, the
+// ±2 g / ±250 deg/s ranges and the FIFO for accel + gyro; read() drains it
+// with one combined I2C transaction per call.
+class I2CImuFifo : public ImuFifo {
+public:
+    explicit I2CImuFifo(const std::string& bus = "/dev/i2c-1", uint8_t address = 0x68,
+                        uint32_t sampleRateHz = 1000);
+    ~I2CImuFifo() override;
+
+    bool isOpen() const { return fd >= 0; }
+
+    size_t read(uint8_t* buffer, size_t capacity) override;
+    uint32_t samplePeriodNs() const override { return periodNs; }
+    uint64_t overflows() const override { return overflowCount; }
+
+private:
+    bool writeRegister(uint8_t reg, uint8_t value);
+    bool readRegisters(uint8_t reg, uint8_t* out, size_t length);
+    void resetFifo();
+
+    int fd = -1;
+    uint8_t address;
+    uint32_t periodNs;
+    uint64_t overflowCount = 0;
+};
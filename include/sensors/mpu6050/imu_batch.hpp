@@ -0,0 +1,32 @@
+#pragma once
+#include "utils/data_types.hpp"
+#include <cstddef>
+#include <cstdint>
+
+enum ImuChannel : size_t {
+    kAccelX, kAccelY, kAccelZ,
+    kGyroX, kGyroY, kGyroZ,
+    kImuChannelCount
+};
+
+// The MPU6050 FIFO holds at most 1024 bytes, i.e. 85 accel+gyro samples;
+// a batch can take several drains' worth.
+constexpr size_t kImuBatchCapacity = 256;
+
+// Structure-of-arrays block of IMU samples: one contiguous, cache-line
+// aligned array per channel so per-channel passes run over unit-stride data.
+// Acceleration is in m/s^2, angular rate in deg/s.
+struct ImuBatch {
+    alignas(64) float channels[kImuChannelCount][kImuBatchCapacity];
+    size_t count = 0;
+    uint64_t last_timestamp_ns = 0;   // CLOCK_MONOTONIC of the newest sample
+    uint32_t sample_period_ns = 0;
+
+    float* channel(ImuChannel c) { return channels[c]; }
+    const float* channel(ImuChannel c) const { return channels[c]; }
+
+    MPU6050Data sample(size_t i) const {
+        return {channels[kAccelX][i], channels[kAccelY][i], channels[kAccelZ][i],
+                channels[kGyroX][i], channels[kGyroY][i], channels[kGyroZ][i]};
+    }
+};
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// One FIFO record with accel and gyro enabled: six big-endian int16 values,
+// accel X/Y/Z followed by gyro X/Y/Z.
+constexpr size_t kMpu6050SampleBytes = 12;
+constexpr size_t kMpu6050FifoBytes = 1024;
+
+// Raw access to the MPU6050 sample FIFO.
+class ImuFifo {
+public:
+    virtual ~ImuFifo() = default;
+
+    // Copies whole samples from the FIFO into `buffer`; returns bytes copied.
+    virtual size_t read(uint8_t* buffer, size_t capacity) = 0;
+    virtual uint32_t samplePeriodNs() const = 0;
+    // Samples lost because the FIFO filled up before it was drained.
+    virtual uint64_t overflows() const = 0;
+};
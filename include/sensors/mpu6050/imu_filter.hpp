@@ -0,0 +1,54 @@
+#pragma once
+#include "sensors/mpu6050/imu_batch.hpp"
+#include <array>
+#include <cstddef>
+
+// Per-channel correction applied as (raw - bias) * scale.
+struct ImuCalibration {
+    std::array<float, kImuChannelCount> bias{};
+    std::array<float, kImuChannelCount> scale{1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+};
+
+struct ImuFilterConfig {
+    float lowpass_alpha = 0.2f;          // y += alpha * (x - y), per channel
+    float complementary_alpha = 0.98f;   // weight of the integrated gyro angle
+    size_t decimation = 10;              // output one averaged sample per N inputs
+};
+
+// Processing stages over an ImuBatch. Calibration and the accelerometer tilt
+// angles are independent per sample and run as unit-stride loops the
+// compiler vectorises. The low-pass and complementary filters are
+// recursive, so they walk each channel sequentially but still over
+// contiguous arrays. State carries over between batches.
+class ImuFilter {
+public:
+    explicit ImuFilter(const ImuFilterConfig& config = ImuFilterConfig{});
+
+    void setCalibration(const ImuCalibration& newCalibration) { calibration = newCalibration; }
+
+    void calibrate(ImuBatch& batch) const;
+    void lowPass(ImuBatch& batch);
+    // Updates pitch/roll (degrees) from the gyro rates and accelerometer tilt.
+    void complementary(const ImuBatch& batch);
+    // Appends the box-car averaged samples of `batch` to `out`.
+    void decimate(const ImuBatch& batch, ImuBatch& out);
+
+    // All four stages in order; `batch` is filtered in place.
+    void process(ImuBatch& batch, ImuBatch& decimated);
+
+    float getPitch() const { return pitch; }
+    float getRoll() const { return roll; }
+
+private:
+    ImuFilterConfig config;
+    ImuCalibration calibration;
+    std::array<float, kImuChannelCount> lowpassState{};
+    bool primed = false;
+    float pitch = 0.0f;
+    float roll = 0.0f;
+    bool orientationPrimed = false;
+    std::array<float, kImuChannelCount> decimationSum{};
+    size_t decimationCount = 0;
+    alignas(64) float accelPitch[kImuBatchCapacity];
+    alignas(64) float accelRoll[kImuBatchCapacity];
+};
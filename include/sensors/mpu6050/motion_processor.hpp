@@ -1,9 +1,34 @@
 #pragma once
+#include "sensors/mpu6050/imu_batch.hpp"
+#include "sensors/mpu6050/imu_fifo.hpp"
 #include "utils/data_types.hpp"
-#include <random>
+#include <cstdint>
+#include <memory>
 
 class MotionProcessor {
 public:
+    // Uses an MPU6050 on /dev/i2c-1 when it answers, otherwise a real-time
+    // SimulatedImuFifo at 1 kHz.
+    MotionProcessor();
+    explicit MotionProcessor(std::unique_ptr<ImuFifo> fifo);
+
+    // Drains the FIFO and returns the newest sample (or the previous one if
+    // the FIFO was empty).
     virtual MPU6050Data readMotionData();
     virtual ~MotionProcessor() = default;
-};
\ No newline at end of file
+
+    // Replaces the contents of `batch` with as many raw samples as the FIFO
+    // holds, up to kImuBatchCapacity. Returns the sample count.
+    size_t readBatch(ImuBatch& batch);
+
+    ImuFifo& getFifo() { return *fifo; }
+    // True when reading an I2CImuFifo rather than a simulated source.
+    bool isHardware() const { return hardware; }
+
+private:
+    std::unique_ptr<ImuFifo> fifo;
+    bool hardware = false;
+    uint8_t raw[kImuBatchCapacity * kMpu6050SampleBytes];
+    ImuBatch latest;
+    MPU6050Data last{};
+};
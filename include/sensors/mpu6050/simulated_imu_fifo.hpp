@@ -0,0 +1,31 @@
+#pragma once
+#include "sensors/mpu6050/imu_fifo.hpp"
+#include <cstdint>
+
+// Stands in for the sensor when no hardware is attached. In real-time mode
+// samples accumulate at the configured rate like in the device FIFO,
+// including overflow once it holds more than kMpu6050FifoBytes. Otherwise
+// samples are only added by push(), which makes runs deterministic.
+class SimulatedImuFifo : public ImuFifo {
+public:
+    explicit SimulatedImuFifo(uint32_t sampleRateHz = 1000, bool realtime = true, uint64_t seed = 1);
+
+    size_t read(uint8_t* buffer, size_t capacity) override;
+    uint32_t samplePeriodNs() const override { return periodNs; }
+    uint64_t overflows() const override { return overflowCount; }
+
+    // Makes `count` more samples available (non-real-time mode).
+    void push(size_t count);
+
+private:
+    void updatePending();
+    void encodeSample(uint8_t* out);
+
+    uint32_t periodNs;
+    bool realtime;
+    uint64_t rngState;
+    uint64_t startNs;
+    uint64_t produced = 0;   // samples generated or accounted as lost
+    size_t pending = 0;
+    uint64_t overflowCount = 0;
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include "utils/latency_histogram.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct SensorTaskConfig {
+    std::string name;
+    std::chrono::nanoseconds period{std::chrono::seconds(1)};
+    std::chrono::nanoseconds jitter_budget{std::chrono::milliseconds(1)};
+    int lane = -1;   // tasks on the same lane share a thread; -1 = own thread
+    int core = -1;   // pins the task's lane to a CPU; -1 = no pinning
+};
+
+struct SensorTaskStats {
+    std::atomic<uint64_t> runs{0};
+    std::atomic<uint64_t> overruns{0};          // finished after the next release, or releases skipped
+    std::atomic<uint64_t> jitter_violations{0}; // started later than jitter_budget after release
+    std::atomic<uint64_t> last_jitter_ns{0};
+    std::atomic<uint64_t> max_jitter_ns{0};
+    std::atomic<uint64_t> last_runtime_ns{0};
+};
+
+// Runs sensor reads at their own rates. Every lane is a thread that sleeps
+// with clock_nanosleep(TIMER_ABSTIME) until the earliest release among its
+// tasks, so periods do not drift and a slow task on one lane (e.g. camera
+// capture) never delays the tasks on another. A task that falls more than a
+// period behind skips the missed releases instead of bursting to catch up.
+// Run times and release jitter are also recorded into Metrics histograms.
+class SensorScheduler {
+public:
+    SensorScheduler() = default;
+    ~SensorScheduler();
+
+    SensorScheduler(const SensorScheduler&) = delete;
+    SensorScheduler& operator=(const SensorScheduler&) = delete;
+
+    // Must be called before start(). Returns the task index.
+    size_t addTask(const SensorTaskConfig& config, std::function<void()> body);
+
+    void start();
+    // Stops all lanes; a sleeping lane exits at its next release.
+    void stop();
+
+    size_t taskCount() const { return tasks.size(); }
+    const SensorTaskConfig& getConfig(size_t task) const { return tasks[task]->config; }
+    const SensorTaskStats& getStats(size_t task) const { return tasks[task]->stats; }
+
+private:
+    struct Task {
+        SensorTaskConfig config;
+        std::function<void()> body;
+        SensorTaskStats stats;
+        LatencyHistogram* runtime;   // Metrics stage "sensor.<name>"
+        LatencyHistogram* jitter;    // Metrics stage "sensor.<name>.jitter"
+        int64_t nextRelease = 0;
+    };
+
+    struct Lane {
+        std::vector<Task*> tasks;
+        int core = -1;
+        std::thread thread;
+    };
+
+    void runLane(Lane& lane);
+
+    std::vector<std::unique_ptr<Task>> tasks;
+    std::vector<std::unique_ptr<Lane>> lanes;
+    std::atomic<bool> running{false};
+};
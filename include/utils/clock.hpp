@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+#include <time.h>
+
+inline uint64_t clockNs(clockid_t clock) {
+    timespec ts;
+    ::clock_gettime(clock, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// For intervals and rates; unaffected by wall-clock adjustments.
+inline uint64_t monotonicNs() {
+    return clockNs(CLOCK_MONOTONIC);
+}
+
+// Wall-clock time, for timestamps that leave the process.
+inline uint64_t realtimeNs() {
+    return clockNs(CLOCK_REALTIME);
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <array>
 #include <stddef.h>
+#include <stdint.h>
 
 struct MPU6050Data {
     float accelX, accelY, accelZ;
@@ -11,6 +12,8 @@ struct CameraFrame {
     int width{};
     int height{};
     size_t size{};
+    uint64_t sequence{};
+    uint64_t timestamp_ns{};   // CLOCK_MONOTONIC at capture
 };
 
 
@@ -18,5 +21,12 @@ struct SystemResources {
     double cpu_usage;
     double memory_usage;
     double power_usage;
+    double soc_temperature = 0.0;   // °C
+    bool throttled = false;
+};
+
+struct ThermalState {
+    double soc_temperature;   // °C
+    bool throttled;           // firmware is currently capping the clocks
 };
 
@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+struct LatencySummary {
+    uint64_t count = 0;
+    uint64_t min_ns = 0;
+    uint64_t max_ns = 0;
+    double mean_ns = 0.0;
+    uint64_t p50_ns = 0;
+    uint64_t p90_ns = 0;
+    uint64_t p99_ns = 0;
+    uint64_t p999_ns = 0;
+};
+
+// HDR-style histogram of nanosecond latencies: every power-of-two range is
+// split into 32 linear sub-buckets, so any value is resolved to within ~3%
+// from 1 ns up to 2^64 ns in a fixed 15 KiB. Recording is a handful of
+// relaxed atomic operations and never allocates, so histograms can stay on
+// in production and be read from another thread at any time.
+class LatencyHistogram {
+public:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr size_t kSubBuckets = size_t(1) << kSubBucketBits;
+    static constexpr size_t kBucketCount = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+    void record(uint64_t ns) {
+        counts[bucketFor(ns)].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(ns, std::memory_order_relaxed);
+        uint64_t seen = maximum.load(std::memory_order_relaxed);
+        while (ns > seen && !maximum.compare_exchange_weak(seen, ns, std::memory_order_relaxed)) {
+        }
+        seen = minimum.load(std::memory_order_relaxed);
+        while (ns < seen && !minimum.compare_exchange_weak(seen, ns, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Bucket counts as of the last summarizeSince() that was given it.
+    struct Window {
+        uint64_t counts[kBucketCount] = {};
+        uint64_t sum = 0;
+    };
+
+    uint64_t count() const { return total.load(std::memory_order_relaxed); }
+
+    // Percentiles report the highest value of their bucket, capped at the
+    // largest value recorded.
+    uint64_t percentile(double fraction) const;
+    LatencySummary summarize() const;
+    // Summarizes only what was recorded since the previous call with
+    // `window`, then moves the window up to now. min/max are resolved to
+    // their bucket, like the percentiles.
+    LatencySummary summarizeSince(Window& window) const;
+    void reset();
+
+    static size_t bucketFor(uint64_t ns) {
+        if (ns < kSubBuckets) {
+            return static_cast<size_t>(ns);
+        }
+        unsigned shift = 63 - static_cast<unsigned>(__builtin_clzll(ns)) - kSubBucketBits;
+        return (size_t(shift) + 1) * kSubBuckets + static_cast<size_t>((ns >> shift) - kSubBuckets);
+    }
+
+    static uint64_t bucketUpperBound(size_t bucket);
+
+private:
+    std::atomic<uint64_t> counts[kBucketCount] = {};
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> maximum{0};
+    std::atomic<uint64_t> minimum{UINT64_MAX};
+};
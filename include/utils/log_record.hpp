@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// On-disk layout written by Logger and read back by the log_decode tool.
+// A log file starts with one LogFileHeader, followed by records made of a
+// LogRecordHeader and `length` payload bytes. All fields are little-endian
+// (native on the Pi and on x86 hosts).
+
+constexpr char kLogFileMagic[8] = {'E', 'R', 'A', 'L', 'O', 'G', '\0', '\0'};
+constexpr uint32_t kLogFormatVersion = 1;
+
+struct LogFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_header_size;
+};
+
+enum LogRecordFlags : uint16_t {
+    kLogRecordTruncated = 1 << 0,
+};
+
+struct LogRecordHeader {
+    uint64_t timestamp_ns;   // CLOCK_REALTIME
+    uint32_t thread_id;
+    uint16_t length;         // payload bytes following the header
+    uint16_t flags;
+};
+
+static_assert(sizeof(LogFileHeader) == 16, "LogFileHeader layout changed");
+static_assert(sizeof(LogRecordHeader) == 16, "LogRecordHeader layout changed");
+
+// Largest payload a single record can carry; longer messages are truncated
+// and flagged with kLogRecordTruncated.
+constexpr size_t kLogPayloadCapacity = 480;
@@ -1,15 +1,42 @@
 #pragma once
-#include <fstream>
-#include <string>
 #include <chrono>
-#include <ctime>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using LogSinkId = uint16_t;
+
+constexpr LogSinkId kInvalidLogSink = 0xFFFF;
+
+struct LogFlushPolicy {
+    size_t batch_records = 64;                      // wake the writer once this many records are pending
+    std::chrono::milliseconds max_delay{200};       // longest a record may sit in the ring
+    std::chrono::milliseconds sync_interval{5000};  // fdatasync cadence per sink, 0 = never
+};
 
+// Asynchronous binary logger. Producers copy the message into a lock-free
+// ring and return; a background writer batches pending records per sink and
+// appends them with writev() to file descriptors that stay open for the
+// lifetime of the process. Files use the format in utils/log_record.hpp and
+// can be read with the log_decode tool.
 class Logger {
 public:
-    static void log(const std::string& filename, const std::string& message) {
-        std::ofstream file(filename, std::ios::app);
-        auto now = std::chrono::system_clock::now();
-        std::time_t time = std::chrono::system_clock::to_time_t(now);
-        file << std::ctime(&time) << message << std::endl;
-    }
+    // Opens (or returns the already opened) sink for `filename`, creating
+    // parent directories as needed. Returns kInvalidLogSink on failure.
+    static LogSinkId openSink(const std::string& filename);
+
+    // Never blocks and never allocates. Returns false if the record was
+    // dropped because the ring was full or the sink is invalid.
+    static bool log(LogSinkId sink, const char* data, size_t length);
+    static bool log(LogSinkId sink, const std::string& message);
+
+    // Convenience overload that resolves the sink by name on every call.
+    static bool log(const std::string& filename, const std::string& message);
+
+    static void setFlushPolicy(const LogFlushPolicy& policy);
+
+    // Blocks until every record pushed before the call has been written.
+    static void flush();
+
+    static uint64_t droppedRecords();
 };
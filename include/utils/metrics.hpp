@@ -0,0 +1,27 @@
+#pragma once
+#include "utils/latency_histogram.hpp"
+#include <string>
+
+// Process-wide registry of per-stage latency histograms. stage() registers
+// a name on first use and returns a histogram that lives as long as the
+// process, so hot paths look it up once and then record lock-free.
+//
+// Snapshots are JSON, one object per line:
+//   {"timestamp_ns":..,"uptime_ns":..,"window_ns":..,"cpu_user_us":..,
+//    "cpu_system_us":..,"max_rss_kb":..,"stages":{"<name>":{"count":..,
+//    "min_ns":..,"mean_ns":..,"p50_ns":..,"p90_ns":..,"p99_ns":..,
+//    "p999_ns":..,"max_ns":..},..}}
+// The process counters are always cumulative (diff consecutive lines for
+// rates). snapshotJson() summarizes the stages since startup; the lines
+// written by writeSnapshot() cover only the window since the previous one.
+class Metrics {
+public:
+    static LatencyHistogram& stage(const std::string& name);
+
+    static std::string snapshotJson();
+    // Appends a windowed snapshot line to `filename`, creating parent
+    // directories. The file stays open between calls; once it passes 1 MiB
+    // it is renamed to `filename`.1 (replacing the previous one) and a new
+    // file is started.
+    static bool writeSnapshot(const std::string& filename);
+};
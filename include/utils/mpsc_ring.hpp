@@ -0,0 +1,88 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Bounded lock-free ring for many producers and a single consumer.
+// Every slot carries a sequence number (Vyukov's scheme): producers claim a
+// position with a CAS and publish it by bumping the slot sequence, so a slow
+// producer never blocks the others. The consumer reads slots in place and
+// hands them back in bulk with release().
+template <typename T, size_t Capacity>
+class MpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "MpscRing capacity must be a power of two");
+
+public:
+    MpscRing() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    // Claims a slot and lets `fill` construct the value in place.
+    // Returns false without calling `fill` when the ring is full.
+    template <typename Fill>
+    bool tryPush(Fill&& fill) {
+        size_t pos = tail.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots[pos & (Capacity - 1)];
+            size_t seq = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+        fill(slot->value);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: returns the published value `offset` entries past the
+    // head, or nullptr if that entry has not been published yet.
+    const T* peek(size_t offset) const {
+        size_t pos = head + offset;
+        const Slot& slot = slots[pos & (Capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return nullptr;
+        }
+        return &slot.value;
+    }
+
+    // Consumer side: returns the first `count` peeked entries to producers.
+    void release(size_t count) {
+        for (size_t i = 0; i < count; ++i, ++head) {
+            slots[head & (Capacity - 1)].sequence.store(head + Capacity, std::memory_order_release);
+        }
+        consumed.store(head, std::memory_order_relaxed);
+    }
+
+    // Approximate number of claimed entries; only meant for wake-up heuristics.
+    size_t sizeApprox() const {
+        return tail.load(std::memory_order_relaxed) - consumed.load(std::memory_order_relaxed);
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::array<Slot, Capacity> slots;
+    alignas(64) std::atomic<size_t> tail{0};
+    alignas(64) size_t head = 0;
+    std::atomic<size_t> consumed{0};
+};
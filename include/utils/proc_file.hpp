@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// A /proc or sysfs file that is opened once and re-read with pread() from
+// offset 0. Reading never allocates, so monitors can poll at high rates.
+class ProcFile {
+public:
+    ProcFile() = default;
+    explicit ProcFile(const std::string& path);
+    ~ProcFile();
+
+    ProcFile(ProcFile&& other) noexcept;
+    ProcFile& operator=(ProcFile&& other) noexcept;
+    ProcFile(const ProcFile&) = delete;
+    ProcFile& operator=(const ProcFile&) = delete;
+
+    bool isOpen() const { return fd >= 0; }
+
+    // Reads up to capacity - 1 bytes and NUL-terminates the buffer.
+    // Returns the number of bytes read, or -1 on error.
+    long read(char* buffer, size_t capacity) const;
+
+    // Reads a sysfs-style attribute holding a single integer.
+    bool readInteger(int64_t& value) const;
+
+private:
+    int fd = -1;
+};
+
+// Allocation-free parsing helpers for /proc text. Each returns the position
+// just past what it consumed.
+const char* skipSpaces(const char* p);
+const char* skipLine(const char* p);
+const char* parseUnsigned(const char* p, uint64_t& value);
+const char* parseDecimal(const char* p, double& value);
+bool startsWith(const char* p, const char* prefix);
@@ -0,0 +1,18 @@
+#pragma once
+#include "utils/clock.hpp"
+#include "utils/latency_histogram.hpp"
+
+// Records the lifetime of the enclosing scope into a histogram.
+class ScopedTimer {
+public:
+    explicit ScopedTimer(LatencyHistogram& histogram)
+        : histogram(histogram), startNs(monotonicNs()) {}
+    ~ScopedTimer() { histogram.record(monotonicNs() - startNs); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    LatencyHistogram& histogram;
+    uint64_t startNs;
+};
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Batches writes to sysfs and cgroup attributes. Values are staged during a
+// control step and written together by commit(). An attribute is only
+// written when the staged value differs from what it last held, so holding
+// a set point costs no syscalls. Files are opened once, by attach().
+class SysfsWriter {
+public:
+    static constexpr size_t kValueCapacity = 64;
+
+    SysfsWriter() = default;
+    ~SysfsWriter();
+    SysfsWriter(const SysfsWriter&) = delete;
+    SysfsWriter& operator=(const SysfsWriter&) = delete;
+
+    // Returns a handle for stage(), or -1 if the file cannot be opened for
+    // writing. The current contents are read so an unchanged first value is
+    // skipped as well.
+    int attach(const std::string& path);
+
+    void stage(int attribute, const char* value);
+    void stage(int attribute, uint64_t value);
+
+    // Writes every staged value that changes its attribute and returns the
+    // number of writes that failed.
+    size_t commit();
+
+    // Contents as last read or successfully written, without trailing newline.
+    const char* current(int attribute) const { return attributes[attribute].current; }
+
+    size_t attributeCount() const { return attributes.size(); }
+    uint64_t writeCount() const { return writes; }
+    uint64_t skippedCount() const { return skipped; }
+    uint64_t failureCount() const { return failures; }
+
+private:
+    struct Attribute {
+        int fd;
+        bool regular;
+        bool pending;
+        char current[kValueCapacity];
+        char staged[kValueCapacity];
+    };
+
+    std::vector<Attribute> attributes;
+    uint64_t writes = 0;
+    uint64_t skipped = 0;
+    uint64_t failures = 0;
+};
@@ -0,0 +1,18 @@
+#pragma once
+#include "utils/data_types.hpp"
+#include "utils/telemetry_channel.hpp"
+
+// Latest readings shared between the sensor and optimizer threads. Each
+// channel has exactly one producer:
+//   resources   - optimizer thread (monitors, merged with thermal state)
+//   motion      - MPU6050 task, decimated samples
+//   temperature - temperature sensor task, °C
+//   frames      - camera task, metadata only
+//   thermal     - thermal task, SoC temperature and throttling
+struct TelemetryBus {
+    TelemetryChannel<SystemResources, 64> resources;
+    TelemetryChannel<MPU6050Data, 256> motion;
+    TelemetryChannel<float, 64> temperature;
+    TelemetryChannel<CameraFrame, 64> frames;
+    TelemetryChannel<ThermalState, 64> thermal;
+};
@@ -0,0 +1,121 @@
+#pragma once
+#include "utils/clock.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Single-producer / multi-consumer history of the last `Capacity` values.
+// Each slot is a seqlock: the producer never waits, and readers retry (or
+// skip a slot) if the producer overwrote it while they were copying. Values
+// are stored as relaxed atomic words, so torn reads are detected rather
+// than being data races. Neither side locks or allocates.
+template <typename T, size_t Capacity>
+class TelemetryChannel {
+    static_assert(std::is_trivially_copyable<T>::value, "telemetry values must be trivially copyable");
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "TelemetryChannel capacity must be a power of two");
+
+public:
+    struct Sample {
+        uint64_t sequence;
+        uint64_t timestamp_ns;   // CLOCK_MONOTONIC
+        T value;
+    };
+
+    // Producer side; only one thread may publish to a channel.
+    void publish(const T& value, uint64_t timestampNs = monotonicNs()) {
+        uint64_t n = published.load(std::memory_order_relaxed);
+        Slot& slot = slots[n & (Capacity - 1)];
+
+        uint64_t words[kWords] = {};
+        std::memcpy(words, &value, sizeof(T));
+
+        slot.sequence.store(2 * n + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.timestamp.store(timestampNs, std::memory_order_relaxed);
+        for (size_t i = 0; i < kWords; ++i) {
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+        slot.sequence.store(2 * n + 2, std::memory_order_release);
+        published.store(n + 1, std::memory_order_release);
+    }
+
+    bool latest(Sample& out) const {
+        for (;;) {
+            uint64_t n = published.load(std::memory_order_acquire);
+            if (n == 0) {
+                return false;
+            }
+            if (read(n - 1, out)) {
+                return true;
+            }
+        }
+    }
+
+    bool latest(T& value) const {
+        Sample sample;
+        if (!latest(sample)) {
+            return false;
+        }
+        value = sample.value;
+        return true;
+    }
+
+    // Copies up to `maxCount` of the newest samples into `out`, oldest first.
+    // Samples overwritten during the copy are left out.
+    size_t history(Sample* out, size_t maxCount) const {
+        uint64_t n = published.load(std::memory_order_acquire);
+        size_t wanted = static_cast<size_t>(n < maxCount ? n : maxCount);
+        if (wanted > Capacity) {
+            wanted = Capacity;
+        }
+
+        // Newest first, so the oldest entries are the ones that get lost.
+        size_t copied = 0;
+        while (copied < wanted && read(n - 1 - copied, out[wanted - 1 - copied])) {
+            ++copied;
+        }
+        if (copied < wanted) {
+            std::memmove(out, out + (wanted - copied), copied * sizeof(Sample));
+        }
+        return copied;
+    }
+
+    uint64_t publishedCount() const { return published.load(std::memory_order_acquire); }
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<uint64_t> timestamp{0};
+        std::atomic<uint64_t> words[kWords] = {};
+    };
+
+    bool read(uint64_t n, Sample& out) const {
+        const Slot& slot = slots[n & (Capacity - 1)];
+        uint64_t expected = 2 * n + 2;
+        if (slot.sequence.load(std::memory_order_acquire) != expected) {
+            return false;
+        }
+        uint64_t words[kWords];
+        uint64_t timestamp = slot.timestamp.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < kWords; ++i) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != expected) {
+            return false;
+        }
+        out.sequence = n;
+        out.timestamp_ns = timestamp;
+        std::memcpy(&out.value, words, sizeof(T));
+        return true;
+    }
+
+    Slot slots[Capacity];
+    alignas(64) std::atomic<uint64_t> published{0};
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Persistent threads for data-parallel loops. parallelFor() splits [0, count)
+// into chunks that the caller and the workers claim from a shared counter,
+// and returns once every chunk is done. Dispatch does not allocate.
+class WorkerPool {
+public:
+    // `threads` includes the calling thread; 0 means hardware_concurrency().
+    explicit WorkerPool(unsigned threads = 0);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+    // Calls body(begin, end) over disjoint ranges covering [0, count).
+    template <typename Body>
+    void parallelFor(size_t count, size_t grain, Body&& body) {
+        using Fn = std::remove_reference_t<Body>;
+        run(count, grain, [](void* ctx, size_t begin, size_t end) {
+            (*static_cast<Fn*>(ctx))(begin, end);
+        }, &body);
+    }
+
+private:
+    using Task = void (*)(void*, size_t, size_t);
+
+    void run(size_t count, size_t grain, Task task, void* context);
+    void workerLoop();
+    void work();
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable done;
+    uint64_t generation = 0;
+    unsigned active = 0;
+    bool stopping = false;
+
+    Task task = nullptr;
+    void* context = nullptr;
+    size_t count = 0;
+    size_t grain = 1;
+    std::atomic<size_t> next{0};
+};
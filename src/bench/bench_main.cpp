@@ -0,0 +1,55 @@
+#include "bench/harness.hpp"
+#include "utils/metrics.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+void usage(const char* program) {
+    std::fprintf(stderr,
+                 "usage: %s [--filter SUBSTRING] [--min-time MS] [--repetitions N] [--json]\n"
+                 "Runs the microbenchmarks and the end-to-end loop benchmark. With --json\n"
+                 "every result is a JSON object on its own line, followed by a Metrics\n"
+                 "snapshot with the per-stage latency histograms. Exits with 2 if a\n"
+                 "result was flagged as not measuring what it claims.\n",
+                 program);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--filter") == 0 && hasValue) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && hasValue) {
+            options.min_time = std::chrono::milliseconds(std::atol(argv[++i]));
+        } else if (std::strcmp(argv[i], "--repetitions") == 0 && hasValue) {
+            options.repetitions = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--json") == 0) {
+            options.json = true;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    BenchRegistry registry;
+    registerGeneticBenchmarks(registry);
+    registerSensorBenchmarks(registry);
+    registerLoopBenchmarks(registry);
+    std::vector<BenchResult> results = registry.run(options);
+
+    std::string snapshot = Metrics::snapshotJson();
+    std::printf("%s%s", options.json ? "" : "\nmetrics: ", snapshot.c_str());
+
+    for (const BenchResult& result : results) {
+        if (!result.warning.empty()) {
+            return 2;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include "bench/harness.hpp"
+#include "genetic/crossover.hpp"
+#include "genetic/fitness.hpp"
+#include "genetic/mutation.hpp"
+#include "genetic/population.hpp"
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t kSeed = 0x42454e4348ull;
+constexpr size_t kSampleCount = 1024;   // power of two, cycled through by the loops
+
+const SystemResources kResources{55.0, 40.0, 4.5, 62.0, false};
+
+std::vector<OptimizationParams> randomParams(size_t count) {
+    OptimizationBounds bounds;
+    CounterRng rng(kSeed, 0);
+    std::vector<OptimizationParams> params(count);
+    for (OptimizationParams& p : params) {
+        p.cpu_threshold = bounds.lower.cpu_threshold +
+                          rng.uniform() * (bounds.upper.cpu_threshold - bounds.lower.cpu_threshold);
+        p.memory_threshold = bounds.lower.memory_threshold +
+                             rng.uniform() * (bounds.upper.memory_threshold - bounds.lower.memory_threshold);
+        p.power_threshold = bounds.lower.power_threshold +
+                            rng.uniform() * (bounds.upper.power_threshold - bounds.lower.power_threshold);
+    }
+    return params;
+}
+
+std::vector<Chromosome> randomChromosomes(size_t count) {
+    std::vector<Chromosome> chromosomes;
+    for (const OptimizationParams& p : randomParams(count)) {
+        chromosomes.emplace_back(p);
+    }
+    return chromosomes;
+}
+
+BenchSetup evolveBench(size_t size, EvolutionMode mode) {
+    return [size, mode] {
+        GeneticConfig config;
+        config.seed = kSeed;
+        config.mode = mode;
+        config.elite_count = mode == EvolutionMode::SteadyState ? 16 : 2;
+        auto population = std::make_shared<Population>(size, config);
+        population->evolve(kResources);
+
+        // Alternate between two readings so steady state re-scores its elites.
+        return [population](uint64_t iterations) {
+            SystemResources moving = kResources;
+            for (uint64_t i = 0; i < iterations; ++i) {
+                moving.cpu_usage = (i & 1) ? 55.0 : 57.0;
+                population->evolve(moving);
+            }
+            benchKeep(population->getGeneration());
+        };
+    };
+}
+
+} // namespace
+
+void registerGeneticBenchmarks(BenchRegistry& registry) {
+    registry.add("fitness/evaluate", [] {
+        auto params = std::make_shared<std::vector<OptimizationParams>>(randomParams(kSampleCount));
+        return [params](uint64_t iterations) {
+            double total = 0.0;
+            for (uint64_t i = 0; i < iterations; ++i) {
+                total += FitnessEvaluator::evaluate((*params)[i & (kSampleCount - 1)], kResources);
+            }
+            benchKeep(total);
+        };
+    });
+
+    registry.add("fitness/evaluate_batch_1k", [] {
+        struct State {
+            std::vector<double> cpu, memory, power, fitness;
+        };
+        auto state = std::make_shared<State>();
+        for (const OptimizationParams& p : randomParams(kSampleCount)) {
+            state->cpu.push_back(p.cpu_threshold);
+            state->memory.push_back(p.memory_threshold);
+            state->power.push_back(p.power_threshold);
+        }
+        state->fitness.resize(kSampleCount);
+        return [state](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                FitnessEvaluator::evaluateBatch(state->cpu.data(), state->memory.data(), state->power.data(),
+                                                state->fitness.data(), kSampleCount, kResources);
+                benchKeep(state->fitness[0]);
+            }
+        };
+    });
+
+    registry.add("crossover/blend", [] {
+        auto parents = std::make_shared<std::vector<Chromosome>>(randomChromosomes(kSampleCount));
+        return [parents](uint64_t iterations) {
+            CounterRng rng(kSeed, 1);
+            Chromosome child1;
+            Chromosome child2;
+            for (uint64_t i = 0; i < iterations; ++i) {
+                Crossover::crossover((*parents)[i & (kSampleCount - 1)], (*parents)[(i + 1) & (kSampleCount - 1)],
+                                     child1, child2, rng);
+                benchKeep(child1);
+            }
+        };
+    });
+
+    registry.add("mutation/mutate", [] {
+        auto chromosomes = std::make_shared<std::vector<Chromosome>>(randomChromosomes(kSampleCount));
+        return [chromosomes](uint64_t iterations) {
+            CounterRng rng(kSeed, 2);
+            OptimizationBounds bounds;
+            for (uint64_t i = 0; i < iterations; ++i) {
+                Mutation::mutate((*chromosomes)[i & (kSampleCount - 1)], 0.1, rng, bounds);
+            }
+            benchKeep((*chromosomes)[0]);
+        };
+    });
+
+    registry.add("population/evolve_generational_1k", evolveBench(1000, EvolutionMode::Generational));
+    registry.add("population/evolve_generational_10k", evolveBench(10000, EvolutionMode::Generational));
+    registry.add("population/evolve_steady_state_10k", evolveBench(10000, EvolutionMode::SteadyState));
+}
@@ -0,0 +1,95 @@
+#include "bench/harness.hpp"
+#include "utils/clock.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+std::string currentWarning;
+
+uint64_t timeRun(const BenchBody& body, uint64_t iterations) {
+    uint64_t start = monotonicNs();
+    body(iterations);
+    return monotonicNs() - start;
+}
+
+void print(const BenchResult& result, bool json) {
+    if (json) {
+        std::printf("{\"name\":\"%s\",\"iterations\":%llu,\"min_ns\":%.2f,\"median_ns\":%.2f,\"max_ns\":%.2f",
+                    result.name.c_str(), static_cast<unsigned long long>(result.iterations),
+                    result.min_ns, result.median_ns, result.max_ns);
+        if (!result.warning.empty()) {
+            std::printf(",\"warning\":\"%s\"", result.warning.c_str());
+        }
+        std::printf("}\n");
+    } else {
+        std::printf("%-40s %12llu %14.1f %14.1f %14.1f\n", result.name.c_str(),
+                    static_cast<unsigned long long>(result.iterations),
+                    result.min_ns, result.median_ns, result.max_ns);
+        if (!result.warning.empty()) {
+            std::printf("  WARNING: %s\n", result.warning.c_str());
+        }
+    }
+    std::fflush(stdout);
+}
+
+} // namespace
+
+void benchWarn(const std::string& message) {
+    if (currentWarning.empty()) {
+        currentWarning = message;
+    }
+}
+
+void BenchRegistry::add(const std::string& name, BenchSetup setup) {
+    entries.push_back({name, std::move(setup)});
+}
+
+std::vector<BenchResult> BenchRegistry::run(const BenchOptions& options) const {
+    uint64_t minNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(options.min_time).count());
+    int repetitions = std::max(options.repetitions, 1);
+
+    if (!options.json) {
+        std::printf("%-40s %12s %14s %14s %14s\n", "benchmark", "iterations",
+                    "min ns/op", "median ns/op", "max ns/op");
+    }
+
+    std::vector<BenchResult> results;
+    for (const Entry& entry : entries) {
+        if (!options.filter.empty() && entry.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        currentWarning.clear();
+        BenchBody body = entry.setup();
+
+        // Grow the batch until one run is long enough to time reliably.
+        uint64_t iterations = 1;
+        for (;;) {
+            uint64_t elapsed = timeRun(body, iterations);
+            if (elapsed >= minNs || iterations >= (uint64_t(1) << 40)) {
+                break;
+            }
+            uint64_t scaled = elapsed == 0 ? iterations * 100
+                                           : iterations * minNs / elapsed + iterations / 10 + 1;
+            iterations = std::min(scaled, iterations * 100);
+        }
+
+        std::vector<double> perOp;
+        for (int r = 0; r < repetitions; ++r) {
+            perOp.push_back(static_cast<double>(timeRun(body, iterations)) / static_cast<double>(iterations));
+        }
+        std::sort(perOp.begin(), perOp.end());
+
+        BenchResult result;
+        result.name = entry.name;
+        result.iterations = iterations;
+        result.min_ns = perOp.front();
+        result.median_ns = perOp[perOp.size() / 2];
+        result.max_ns = perOp.back();
+        result.warning = currentWarning;
+        print(result, options.json);
+        results.push_back(result);
+    }
+    return results;
+}
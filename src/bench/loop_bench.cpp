@@ -0,0 +1,152 @@
+#include "bench/harness.hpp"
+#include "genetic/population.hpp"
+#include "resource/cpu/cpu_optimizer.hpp"
+#include "resource/memory/memory_optimizer.hpp"
+#include "resource/power/power_optimizer.hpp"
+#include "utils/logger.hpp"
+#include "utils/metrics.hpp"
+#include "utils/scoped_timer.hpp"
+#include "utils/telemetry_bus.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t kSeed = 0x42454e4348ull;
+constexpr size_t kTraceLength = 4096;   // power of two
+const std::string kScratchRoot = "/tmp/era_bench";
+
+void writeFile(const std::string& path, const std::string& contents) {
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+    std::ofstream(path) << contents;
+}
+
+// Random walk over plausible readings; identical on every run.
+std::vector<SystemResources> resourceTrace() {
+    CounterRng rng(kSeed, 3);
+    std::vector<SystemResources> trace(kTraceLength);
+    SystemResources current{50.0, 40.0, 5.0, 60.0, false};
+    for (SystemResources& sample : trace) {
+        current.cpu_usage = std::min(100.0, std::max(0.0, current.cpu_usage + rng.normal() * 2.0));
+        current.memory_usage = std::min(100.0, std::max(0.0, current.memory_usage + rng.normal() * 0.5));
+        current.power_usage = std::min(15.0, std::max(0.5, current.power_usage + rng.normal() * 0.2));
+        current.soc_temperature = std::min(90.0, std::max(35.0, current.soc_temperature + rng.normal()));
+        current.throttled = current.soc_temperature >= 80.0;
+        sample = current;
+    }
+    return trace;
+}
+
+// The optimizer thread's cycle from main.cpp with the monitors replaced by
+// a recorded trace and the actuators pointed at a scratch cgroup tree.
+struct LoopState {
+    LoopState()
+        : trace(resourceTrace()),
+          population(10000, config()),
+          cpuOptimizer(kScratchRoot + "/cgroup", kScratchRoot + "/sys", {2.0, std::chrono::milliseconds(0)}),
+          memOptimizer(kScratchRoot + "/cgroup", kScratchRoot + "/proc", {2.0, std::chrono::milliseconds(0)}),
+          powerOptimizer(kScratchRoot + "/sys", powerConfig()),
+          log(Logger::openSink(kScratchRoot + "/loop.log")),
+          sampleStage(Metrics::stage("bench.loop.sample")),
+          evolveStage(Metrics::stage("bench.loop.evolve")),
+          actuateStage(Metrics::stage("bench.loop.actuate")),
+          logStage(Metrics::stage("bench.loop.log")) {}
+
+    static GeneticConfig config() {
+        GeneticConfig gaConfig;
+        gaConfig.seed = kSeed;
+        gaConfig.mode = EvolutionMode::SteadyState;
+        gaConfig.elite_count = 16;
+        return gaConfig;
+    }
+
+    static PowerOptimizerConfig powerConfig() {
+        PowerOptimizerConfig config;
+        config.enabled = true;
+        config.max_power_watts = 6.0;
+        return config;
+    }
+
+    void cycle() {
+        SystemResources current;
+        {
+            ScopedTimer timer(sampleStage);
+            bus.resources.publish(trace[step++ & (kTraceLength - 1)]);
+            bus.resources.latest(current);
+        }
+
+        OptimizationParams params;
+        {
+            ScopedTimer timer(evolveStage);
+            population.evolve(current);
+            params = population.getBestChromosome().getParams();
+        }
+
+        {
+            ScopedTimer timer(actuateStage);
+            cpuOptimizer.optimize(params.cpu_threshold);
+            memOptimizer.optimize(params.memory_threshold);
+            powerOptimizer.optimize(params.power_threshold);
+        }
+
+        {
+            ScopedTimer timer(logStage);
+            char entry[256];
+            int length = std::snprintf(entry, sizeof(entry),
+                                       "cpu %.2f%% mem %.2f%% power %.2fW -> %.2f%% %.2f%% %.2fW\n",
+                                       current.cpu_usage, current.memory_usage, current.power_usage,
+                                       params.cpu_threshold, params.memory_threshold, params.power_threshold);
+            Logger::log(log, entry, static_cast<size_t>(length));
+        }
+    }
+
+    std::vector<SystemResources> trace;
+    uint64_t step = 0;
+    TelemetryBus bus;
+    Population population;
+    CPUOptimizer cpuOptimizer;
+    MemoryOptimizer memOptimizer;
+    PowerOptimizer powerOptimizer;
+    LogSinkId log;
+    LatencyHistogram& sampleStage;
+    LatencyHistogram& evolveStage;
+    LatencyHistogram& actuateStage;
+    LatencyHistogram& logStage;
+};
+
+void prepareScratchTree() {
+    writeFile(kScratchRoot + "/cgroup/cpu.max", "max 100000\n");
+    writeFile(kScratchRoot + "/cgroup/cpuset.cpus", "0-3\n");
+    writeFile(kScratchRoot + "/cgroup/memory.high", "max\n");
+    writeFile(kScratchRoot + "/proc/meminfo", "MemTotal:        4000000 kB\n");
+    for (int cpu = 0; cpu < 4; ++cpu) {
+        std::filesystem::create_directories(kScratchRoot + "/sys/devices/system/cpu/cpu" + std::to_string(cpu));
+    }
+    const std::string policy = kScratchRoot + "/sys/devices/system/cpu/cpufreq/policy0";
+    writeFile(policy + "/cpuinfo_max_freq", "1800000\n");
+    writeFile(policy + "/cpuinfo_min_freq", "600000\n");
+    writeFile(policy + "/scaling_min_freq", "600000\n");
+    writeFile(policy + "/scaling_max_freq", "1800000\n");
+    writeFile(policy + "/scaling_available_frequencies", "600000 1000000 1400000 1800000\n");
+    writeFile(policy + "/scaling_available_governors", "conservative ondemand powersave performance schedutil\n");
+    writeFile(policy + "/scaling_governor", "ondemand\n");
+}
+
+} // namespace
+
+void registerLoopBenchmarks(BenchRegistry& registry) {
+    registry.add("loop/end_to_end", [] {
+        prepareScratchTree();
+        auto state = std::make_shared<LoopState>();
+        return [state](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                state->cycle();
+            }
+        };
+    });
+}
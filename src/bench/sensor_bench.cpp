@@ -0,0 +1,143 @@
+#include "bench/harness.hpp"
+#include "resource/cpu/cpu_monitor.hpp"
+#include "resource/memory/memory_monitor.hpp"
+#include "resource/power/power_monitor.hpp"
+#include "resource/thermal/thermal_monitor.hpp"
+#include "sensors/camera/camera_capture.hpp"
+#include "sensors/mpu6050/imu_filter.hpp"
+#include "sensors/mpu6050/motion_processor.hpp"
+#include "sensors/mpu6050/simulated_imu_fifo.hpp"
+#include "sensors/temperature/temp_reader.hpp"
+#include "utils/logger.hpp"
+#include "utils/telemetry_bus.hpp"
+#include <memory>
+#include <string>
+
+namespace {
+
+constexpr uint64_t kSeed = 0x42454e4348ull;
+constexpr size_t kImuSamplesPerRead = 10;   // 10 ms of FIFO at 1 kHz
+constexpr uint64_t kLogFlushEvery = 512;    // half the logger's 1024-slot ring
+
+template <typename Monitor>
+BenchSetup monitorBench() {
+    return [] {
+        auto monitor = std::make_shared<Monitor>();
+        return [monitor](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                benchKeep(monitor->getCurrentUsage());
+            }
+        };
+    };
+}
+
+} // namespace
+
+void registerSensorBenchmarks(BenchRegistry& registry) {
+    registry.add("sensor/temperature_read", [] {
+        auto reader = std::make_shared<TempReader>();
+        return [reader](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                benchKeep(reader->readTemperature());
+            }
+        };
+    });
+
+    registry.add("sensor/mpu6050_read_batch", [] {
+        struct State {
+            SimulatedImuFifo* fifo;
+            std::unique_ptr<MotionProcessor> processor;
+            ImuBatch batch;
+        };
+        auto state = std::make_shared<State>();
+        auto fifo = std::make_unique<SimulatedImuFifo>(1000, false, kSeed);
+        state->fifo = fifo.get();
+        state->processor = std::make_unique<MotionProcessor>(std::move(fifo));
+        return [state](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                state->fifo->push(kImuSamplesPerRead);
+                benchKeep(state->processor->readBatch(state->batch));
+            }
+        };
+    });
+
+    registry.add("sensor/mpu6050_filter", [] {
+        struct State {
+            ImuFilter filter;
+            ImuBatch raw;
+            ImuBatch batch;
+            ImuBatch decimated;
+        };
+        auto state = std::make_shared<State>();
+        auto fifo = std::make_unique<SimulatedImuFifo>(1000, false, kSeed);
+        fifo->push(kImuSamplesPerRead);
+        MotionProcessor(std::move(fifo)).readBatch(state->raw);
+        return [state](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                state->batch = state->raw;
+                state->decimated.count = 0;
+                state->filter.process(state->batch, state->decimated);
+                benchKeep(state->decimated.count);
+            }
+        };
+    });
+
+    registry.add("sensor/camera_capture_synthetic", [] {
+        CameraConfig config;
+        config.backend = CameraBackend::Synthetic;
+        auto camera = std::make_shared<CameraCapture>(config);
+        return [camera](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                benchKeep(camera->captureFrame().size);
+            }
+        };
+    });
+
+    registry.add("monitor/cpu", monitorBench<CPUMonitor>());
+    registry.add("monitor/memory", monitorBench<MemoryMonitor>());
+    registry.add("monitor/power", monitorBench<PowerMonitor>());
+    registry.add("monitor/thermal", [] {
+        auto monitor = std::make_shared<ThermalMonitor>();
+        return [monitor](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                benchKeep(monitor->getCurrentState());
+            }
+        };
+    });
+
+    // Flushes every kLogFlushEvery records so the ring never fills and every
+    // timed operation is a record that reached the file: the sustained cost
+    // per record including the writer, not the producer's push alone.
+    registry.add("logger/log_sustained", [] {
+        LogSinkId sink = Logger::openSink("/tmp/era_bench/bench.log");
+        auto message = std::make_shared<std::string>(100, 'x');
+        return [sink, message](uint64_t iterations) {
+            uint64_t droppedBefore = Logger::droppedRecords();
+            for (uint64_t i = 0; i < iterations; ++i) {
+                benchKeep(Logger::log(sink, *message));
+                if ((i + 1) % kLogFlushEvery == 0) {
+                    Logger::flush();
+                }
+            }
+            Logger::flush();
+            uint64_t dropped = Logger::droppedRecords() - droppedBefore;
+            if (dropped != 0) {
+                benchWarn(std::to_string(dropped) + " of " + std::to_string(iterations) +
+                          " records dropped");
+            }
+        };
+    });
+
+    registry.add("telemetry/publish_latest", [] {
+        auto bus = std::make_shared<TelemetryBus>();
+        return [bus](uint64_t iterations) {
+            SystemResources sample{};
+            for (uint64_t i = 0; i < iterations; ++i) {
+                sample.cpu_usage = static_cast<double>(i & 63);
+                bus->resources.publish(sample, i);
+                bus->resources.latest(sample);
+            }
+            benchKeep(sample);
+        };
+    });
+}
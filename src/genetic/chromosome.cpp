@@ -0,0 +1,23 @@
+#include "genetic/chromosome.hpp"
+#include "genetic/fitness.hpp"
+
+Chromosome::Chromosome() : params{0.0, 0.0, 0.0}, fitness(0.0) {}
+
+Chromosome::Chromosome(const OptimizationParams& params, double fitness)
+    : params(params), fitness(fitness) {}
+
+void Chromosome::calculateFitness(const SystemResources& current) {
+    fitness = FitnessEvaluator::evaluate(*this, current);
+}
+
+OptimizationParams Chromosome::getParams() const {
+    return params;
+}
+
+void Chromosome::setParams(const OptimizationParams& newParams) {
+    params = newParams;
+}
+
+double Chromosome::getFitness() const {
+    return fitness;
+}
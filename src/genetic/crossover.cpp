@@ -0,0 +1,15 @@
+#include "genetic/crossover.hpp"
+
+void Crossover::crossover(const Chromosome& parent1, const Chromosome& parent2,
+                          Chromosome& child1, Chromosome& child2, CounterRng& rng) {
+    GeneArray genes1 = toGenes(parent1.getParams());
+    GeneArray genes2 = toGenes(parent2.getParams());
+    GeneArray out1;
+    GeneArray out2;
+    double alpha = rng.uniform();
+    for (size_t g = 0; g < kGeneCount; ++g) {
+        blend(genes1[g], genes2[g], alpha, out1[g], out2[g]);
+    }
+    child1.setParams(fromGenes(out1));
+    child2.setParams(fromGenes(out2));
+}
@@ -0,0 +1,82 @@
+#include "genetic/fitness.hpp"
+#include <algorithm>
+
+namespace {
+
+constexpr double kCpuHeadroom = 15.0;     // percent
+constexpr double kMemoryHeadroom = 10.0;  // percent
+constexpr double kPowerHeadroom = 1.5;    // watts
+constexpr double kPercentScale = 1.0 / 100.0;
+constexpr double kPowerScale = 1.0 / 15.0;
+constexpr double kUnderUsageWeight = 4.0;
+
+// Thermal pressure ramps from 0 at the soft limit to 1 at the soft limit plus
+// the range, and is 1 while the firmware is throttling. Under pressure the
+// CPU and power targets move below the current usage.
+constexpr double kThermalSoftLimit = 70.0;  // °C
+constexpr double kThermalRange = 10.0;      // °C
+constexpr double kCpuThermalBackoff = 30.0; // percent at full pressure
+constexpr double kPowerThermalBackoff = 3.0; // watts at full pressure
+
+double thermalPressure(const SystemResources& r) {
+    if (r.throttled) {
+        return 1.0;
+    }
+    return std::min(std::max((r.soc_temperature - kThermalSoftLimit) / kThermalRange, 0.0), 1.0);
+}
+
+// Per-call constants of the score, hoisted out of the batch loop.
+struct Targets {
+    double cpu;
+    double memory;
+    double power;
+    double cpuUsage;
+    double memoryUsage;
+    double powerUsage;
+    double underWeight;   // reduced for CPU/power under thermal pressure
+};
+
+Targets targetsFor(const SystemResources& r) {
+    double pressure = thermalPressure(r);
+    return {r.cpu_usage + kCpuHeadroom - pressure * kCpuThermalBackoff,
+            r.memory_usage + kMemoryHeadroom,
+            r.power_usage + kPowerHeadroom - pressure * kPowerThermalBackoff,
+            r.cpu_usage,
+            r.memory_usage,
+            r.power_usage,
+            kUnderUsageWeight * (1.0 - pressure)};
+}
+
+inline double score(double cpu, double memory, double power, const Targets& t) {
+    double dc = (cpu - t.cpu) * kPercentScale;
+    double dm = (memory - t.memory) * kPercentScale;
+    double dp = (power - t.power) * kPowerScale;
+    double uc = std::max(t.cpuUsage - cpu, 0.0) * kPercentScale;
+    double um = std::max(t.memoryUsage - memory, 0.0) * kPercentScale;
+    double up = std::max(t.powerUsage - power, 0.0) * kPowerScale;
+    double error = dc * dc + dm * dm + dp * dp +
+                   t.underWeight * (uc * uc + up * up) + kUnderUsageWeight * um * um;
+    return 1.0 / (1.0 + error);
+}
+
+} // namespace
+
+double FitnessEvaluator::evaluate(const Chromosome& chromosome, const SystemResources& resources) {
+    return evaluate(chromosome.getParams(), resources);
+}
+
+double FitnessEvaluator::evaluate(const OptimizationParams& params, const SystemResources& resources) {
+    return score(params.cpu_threshold, params.memory_threshold, params.power_threshold, targetsFor(resources));
+}
+
+void FitnessEvaluator::evaluateBatch(const double* __restrict cpuThresholds,
+                                     const double* __restrict memoryThresholds,
+                                     const double* __restrict powerThresholds,
+                                     double* __restrict fitness,
+                                     size_t count,
+                                     const SystemResources& resources) {
+    const Targets targets = targetsFor(resources);
+    for (size_t i = 0; i < count; ++i) {
+        fitness[i] = score(cpuThresholds[i], memoryThresholds[i], powerThresholds[i], targets);
+    }
+}
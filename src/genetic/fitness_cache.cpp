@@ -0,0 +1,69 @@
+#include "genetic/fitness_cache.hpp"
+#include "genetic/rng.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+uint64_t bitsOf(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+int32_t quantise(double value, double width) {
+    return static_cast<int32_t>(std::floor(value / width));
+}
+
+} // namespace
+
+FitnessCache::FitnessCache(size_t capacity, double bucketWidth)
+    : bucketWidth(bucketWidth > 0.0 ? bucketWidth : 1.0) {
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    entries.assign(size, Entry{});
+    mask = size - 1;
+}
+
+void FitnessCache::setResources(const SystemResources& resources) {
+    bucket = {quantise(resources.cpu_usage, bucketWidth),
+              quantise(resources.memory_usage, bucketWidth),
+              quantise(resources.power_usage, bucketWidth),
+              quantise(resources.soc_temperature, bucketWidth),
+              resources.throttled ? 1 : 0};
+    bucketHash = 0;
+    for (int32_t b : bucket) {
+        bucketHash = CounterRng::mix(bucketHash ^ static_cast<uint32_t>(b));
+    }
+}
+
+bool FitnessCache::lookup(const GeneArray& genes, double& fitness) {
+    const Entry& entry = entries[slotFor(genes)];
+    if (entry.valid && entry.bucket == bucket && entry.genes == genes) {
+        fitness = entry.fitness;
+        ++hitCount;
+        return true;
+    }
+    ++missCount;
+    return false;
+}
+
+void FitnessCache::insert(const GeneArray& genes, double fitness) {
+    entries[slotFor(genes)] = Entry{genes, bucket, fitness, true};
+}
+
+void FitnessCache::clear() {
+    for (Entry& entry : entries) {
+        entry.valid = false;
+    }
+}
+
+size_t FitnessCache::slotFor(const GeneArray& genes) const {
+    uint64_t hash = bucketHash;
+    for (double gene : genes) {
+        hash = CounterRng::mix(hash ^ bitsOf(gene));
+    }
+    return static_cast<size_t>(hash) & mask;
+}
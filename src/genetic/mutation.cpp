@@ -0,0 +1,12 @@
+#include "genetic/mutation.hpp"
+
+void Mutation::mutate(Chromosome& chromosome, double mutationRate, CounterRng& rng,
+                      const OptimizationBounds& bounds, double sigma) {
+    GeneArray genes = toGenes(chromosome.getParams());
+    GeneArray lower = toGenes(bounds.lower);
+    GeneArray upper = toGenes(bounds.upper);
+    for (size_t g = 0; g < kGeneCount; ++g) {
+        genes[g] = mutateGene(genes[g], lower[g], upper[g], mutationRate, sigma, rng);
+    }
+    chromosome.setParams(fromGenes(genes));
+}
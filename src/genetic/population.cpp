@@ -0,0 +1,283 @@
+#include "genetic/population.hpp"
+#include "genetic/crossover.hpp"
+#include "genetic/fitness.hpp"
+#include "genetic/mutation.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr size_t kEvaluateGrain = 4096;
+constexpr size_t kBreedGrain = 1024;   // pairs
+
+} // namespace
+
+Population::Population(size_t size) : Population(size, GeneticConfig{}) {}
+
+Population::Population(size_t size, const GeneticConfig& config)
+    : config(config),
+      populationSize(std::max<size_t>(size, 2)),
+      cache(config.fitness_cache_size, config.cache_bucket_width),
+      pool(config.threads) {
+    this->config.elite_count = std::min(config.elite_count, populationSize - 1);
+    this->config.tournament_size = std::max<size_t>(config.tournament_size, 1);
+    elites.reserve(this->config.elite_count);
+
+    for (Generation& buffer : buffers) {
+        for (std::vector<double>& gene : buffer.genes) {
+            gene.resize(populationSize);
+        }
+        buffer.fitness.resize(populationSize);
+    }
+
+    GeneArray lower = toGenes(config.bounds.lower);
+    GeneArray upper = toGenes(config.bounds.upper);
+    Generation& initial = buffers[currentBuffer];
+    for (size_t i = 0; i < populationSize; ++i) {
+        CounterRng rng(config.seed, i);
+        for (size_t g = 0; g < kGeneCount; ++g) {
+            initial.genes[g][i] = lower[g] + rng.uniform() * (upper[g] - lower[g]);
+        }
+    }
+    evaluate(initial);
+    selectElites(initial);
+}
+
+void Population::evolve(const SystemResources& current) {
+    resources = current;
+    haveResources = true;
+    evolve();
+}
+
+void Population::evolve() {
+    if (config.mode == EvolutionMode::SteadyState) {
+        steadyStateStep();
+        return;
+    }
+
+    Generation& source = buffers[currentBuffer];
+    Generation& target = buffers[currentBuffer ^ 1];
+
+    // The previous call left `source` scored; only re-score it if the
+    // resources changed since then.
+    if (resourcesChanged()) {
+        evaluate(source);
+        selectElites(source);
+    }
+
+    for (size_t e = 0; e < elites.size(); ++e) {
+        for (size_t g = 0; g < kGeneCount; ++g) {
+            target.genes[g][e] = source.genes[g][elites[e]];
+        }
+    }
+
+    size_t offspring = populationSize - elites.size();
+    size_t pairs = (offspring + 1) / 2;
+    pool.parallelFor(pairs, kBreedGrain, [&](size_t begin, size_t end) {
+        breed(source, target, begin, end);
+    });
+
+    currentBuffer ^= 1;
+    ++generation;
+    evaluate(target);
+    selectElites(target);
+}
+
+Chromosome Population::getBestChromosome() const {
+    const Generation& current = buffers[currentBuffer];
+    GeneArray genes;
+    for (size_t g = 0; g < kGeneCount; ++g) {
+        genes[g] = current.genes[g][bestIndex];
+    }
+    return Chromosome(fromGenes(genes), current.fitness[bestIndex]);
+}
+
+void Population::evaluate(Generation& target) {
+    pool.parallelFor(populationSize, kEvaluateGrain, [&](size_t begin, size_t end) {
+        FitnessEvaluator::evaluateBatch(
+            target.genes[0].data() + begin,
+            target.genes[1].data() + begin,
+            target.genes[2].data() + begin,
+            target.fitness.data() + begin,
+            end - begin,
+            resources);
+    });
+
+    evaluations += populationSize;
+    scoredResources = resources;
+    cache.setResources(resources);
+
+    const double* fitness = target.fitness.data();
+    bestIndex = static_cast<size_t>(std::max_element(fitness, fitness + populationSize) - fitness);
+}
+
+// Keeps the indices of the elite_count fittest individuals, best first.
+void Population::selectElites(const Generation& source) {
+    elites.clear();
+    for (size_t i = 0; i < populationSize; ++i) {
+        offerElite(i, source.fitness);
+    }
+}
+
+size_t Population::tournament(const Generation& source, CounterRng& rng) const {
+    size_t winner = rng.below(populationSize);
+    for (size_t round = 1; round < config.tournament_size; ++round) {
+        size_t challenger = rng.below(populationSize);
+        if (source.fitness[challenger] > source.fitness[winner]) {
+            winner = challenger;
+        }
+    }
+    return winner;
+}
+
+void Population::breed(const Generation& source, Generation& target, size_t firstPair, size_t lastPair) {
+    GeneArray lower = toGenes(config.bounds.lower);
+    GeneArray upper = toGenes(config.bounds.upper);
+    size_t offspringBegin = elites.size();
+
+    for (size_t pair = firstPair; pair < lastPair; ++pair) {
+        CounterRng rng(config.seed, ((generation + 1) << 32) | pair);
+        size_t parent1 = tournament(source, rng);
+        size_t parent2 = tournament(source, rng);
+        bool cross = rng.uniform() < config.crossover_rate;
+        double alpha = rng.uniform();
+
+        size_t child1 = offspringBegin + 2 * pair;
+        size_t child2 = child1 + 1;
+        for (size_t g = 0; g < kGeneCount; ++g) {
+            double gene1 = source.genes[g][parent1];
+            double gene2 = source.genes[g][parent2];
+            if (cross) {
+                Crossover::blend(source.genes[g][parent1], source.genes[g][parent2], alpha, gene1, gene2);
+            }
+            gene1 = Mutation::mutateGene(gene1, lower[g], upper[g], config.mutation_rate, config.mutation_sigma, rng);
+            gene2 = Mutation::mutateGene(gene2, lower[g], upper[g], config.mutation_rate, config.mutation_sigma, rng);
+
+            target.genes[g][child1] = gene1;
+            if (child2 < populationSize) {
+                target.genes[g][child2] = gene2;
+            }
+        }
+    }
+}
+
+void Population::steadyStateStep() {
+    Generation& current = buffers[currentBuffer];
+    std::vector<double>& fitness = current.fitness;
+
+    if (!haveResources) {
+        // The constructor scored against zeroed resources; breeding on those
+        // scores would seed the population with meaningless winners.
+        return;
+    }
+    if (generation == 0) {
+        // Warm start: score everyone once against the first real sample.
+        evaluate(current);
+        selectElites(current);
+    } else if (resourcesMoved()) {
+        scoredResources = resources;
+        cache.setResources(resources);
+        for (size_t index : elites) {
+            GeneArray genes;
+            for (size_t g = 0; g < kGeneCount; ++g) {
+                genes[g] = current.genes[g][index];
+            }
+            fitness[index] = scoreCached(genes);
+        }
+        std::sort(elites.begin(), elites.end(), [&](size_t lhs, size_t rhs) {
+            return fitness[lhs] > fitness[rhs];
+        });
+    }
+
+    GeneArray lower = toGenes(config.bounds.lower);
+    GeneArray upper = toGenes(config.bounds.upper);
+    for (size_t o = 0; o < config.steady_state_offspring; ++o) {
+        CounterRng rng(config.seed, ((generation + 1) << 32) | o);
+        size_t parent1 = tournament(current, rng);
+        size_t parent2 = tournament(current, rng);
+        bool cross = rng.uniform() < config.crossover_rate;
+        double alpha = rng.uniform();
+
+        GeneArray child;
+        for (size_t g = 0; g < kGeneCount; ++g) {
+            double gene = current.genes[g][parent1];
+            if (cross) {
+                double unused;
+                Crossover::blend(current.genes[g][parent1], current.genes[g][parent2], alpha, gene, unused);
+            }
+            child[g] = Mutation::mutateGene(gene, lower[g], upper[g], config.mutation_rate, config.mutation_sigma, rng);
+        }
+        double childFitness = FitnessEvaluator::evaluate(fromGenes(child), resources);
+        ++evaluations;
+
+        // Inverse tournament: the weakest of a few random individuals is
+        // replaced if the child beats it. Elites are never replaced.
+        size_t victim = rng.below(populationSize);
+        for (size_t round = 1; round < config.tournament_size; ++round) {
+            size_t challenger = rng.below(populationSize);
+            if (fitness[challenger] < fitness[victim]) {
+                victim = challenger;
+            }
+        }
+        if (childFitness <= fitness[victim] ||
+            std::find(elites.begin(), elites.end(), victim) != elites.end()) {
+            continue;
+        }
+
+        for (size_t g = 0; g < kGeneCount; ++g) {
+            current.genes[g][victim] = child[g];
+        }
+        fitness[victim] = childFitness;
+        offerElite(victim, fitness);
+    }
+
+    if (!elites.empty()) {
+        bestIndex = elites.front();
+    }
+    ++generation;
+}
+
+double Population::scoreCached(const GeneArray& genes) {
+    double fitness;
+    if (config.fitness_cache_size == 0 || !cache.lookup(genes, fitness)) {
+        fitness = FitnessEvaluator::evaluate(fromGenes(genes), resources);
+        if (config.fitness_cache_size != 0) {
+            cache.insert(genes, fitness);
+        }
+        ++evaluations;
+    }
+    return fitness;
+}
+
+bool Population::resourcesChanged() const {
+    return resources.cpu_usage != scoredResources.cpu_usage ||
+           resources.memory_usage != scoredResources.memory_usage ||
+           resources.power_usage != scoredResources.power_usage ||
+           resources.soc_temperature != scoredResources.soc_temperature ||
+           resources.throttled != scoredResources.throttled;
+}
+
+bool Population::resourcesMoved() const {
+    return std::abs(resources.cpu_usage - scoredResources.cpu_usage) > config.cpu_epsilon ||
+           std::abs(resources.memory_usage - scoredResources.memory_usage) > config.memory_epsilon ||
+           std::abs(resources.power_usage - scoredResources.power_usage) > config.power_epsilon ||
+           std::abs(resources.soc_temperature - scoredResources.soc_temperature) > config.temperature_epsilon ||
+           resources.throttled != scoredResources.throttled;
+}
+
+// Inserts `index` into the sorted elite list if it scores high enough.
+void Population::offerElite(size_t index, const std::vector<double>& fitness) {
+    if (config.elite_count == 0) {
+        return;
+    }
+    if (elites.size() == config.elite_count) {
+        if (fitness[index] <= fitness[elites.back()]) {
+            return;
+        }
+        elites.pop_back();
+    }
+    auto pos = std::upper_bound(elites.begin(), elites.end(), index, [&](size_t lhs, size_t rhs) {
+        return fitness[lhs] > fitness[rhs];
+    });
+    elites.insert(pos, index);
+}
@@ -1,81 +1,248 @@
 // src/main.cpp
 #include "sensors/temperature/temp_reader.hpp"
 #include "sensors/mpu6050/motion_processor.hpp"
+#include "sensors/mpu6050/imu_filter.hpp"
 #include "sensors/camera/camera_capture.hpp"
+#include "sensors/sensor_scheduler.hpp"
 #include "resource/cpu/cpu_monitor.hpp"
+#include "resource/cpu/cpu_optimizer.hpp"
 #include "resource/memory/memory_monitor.hpp"
+#include "resource/memory/memory_optimizer.hpp"
 #include "resource/power/power_monitor.hpp"
+#include "resource/power/power_optimizer.hpp"
+#include "resource/thermal/thermal_monitor.hpp"
 #include "genetic/population.hpp"
 #include "utils/logger.hpp"
+#include "utils/metrics.hpp"
+#include "utils/scoped_timer.hpp"
+#include "utils/telemetry_bus.hpp"
 #include <thread>
 #include <chrono>
+#include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <memory>
 
-void sensorDataCollection() {
+struct ActuatorOptions {
+    std::string cgroup_dir;   // managed cgroup v2 directory; empty = no CPU/memory actuation
+    PowerOptimizerConfig power;
+};
+
+void sensorDataCollection(TelemetryBus& bus) {
     TempReader tempSensor;
     MotionProcessor mpuSensor;
     CameraCapture camSensor;
-    
-    while (true) {
-        // Read sensors
-        float temp = tempSensor.readTemperature();
-        MPU6050Data mpuData = mpuSensor.readMotionData();
+    ThermalMonitor thermalMonitor;
+    LogSinkId sensorLog = Logger::openSink("data/sensor_logs/sensor_data.log");
+    const CameraConfig& camConfig = camSensor.getConfig();
+    Logger::log(sensorLog, camConfig.backend == CameraBackend::V4L2
+                               ? "Camera: V4L2 " + camConfig.device + (camSensor.isOpen() ? "\n" : " (failed to open)\n")
+                               : std::string("Camera: synthetic, no ") + camConfig.device + "\n");
+    Logger::log(sensorLog, mpuSensor.isHardware() ? "MPU6050: I2C /dev/i2c-1\n"
+                                                  : "MPU6050: simulated, no sensor on /dev/i2c-1\n");
+
+    SensorScheduler scheduler;
+    // The MPU6050 samples at 1 kHz into its FIFO; drain it in batches of ~10
+    ImuFilter mpuFilter;
+    ImuBatch mpuBatch;
+    ImuBatch mpuDecimated;
+    scheduler.addTask({"mpu6050", std::chrono::milliseconds(10), std::chrono::milliseconds(1)}, [&] {
+        mpuSensor.readBatch(mpuBatch);
+        mpuDecimated.count = 0;
+        mpuFilter.process(mpuBatch, mpuDecimated);
+        for (size_t i = 0; i < mpuDecimated.count; ++i) {
+            bus.motion.publish(mpuDecimated.sample(i));
+        }
+    });
+    scheduler.addTask({"camera", std::chrono::milliseconds(33), std::chrono::milliseconds(5)}, [&] {
         CameraFrame frame = camSensor.captureFrame();
-        
-        // Log data using string concatenation with std::string
+        if (frame.size != 0) {
+            bus.frames.publish(frame, frame.timestamp_ns);
+        }
+    });
+    scheduler.addTask({"temperature", std::chrono::seconds(1), std::chrono::milliseconds(10), 0}, [&] {
+        bus.temperature.publish(tempSensor.readTemperature());
+    });
+    scheduler.addTask({"thermal", std::chrono::seconds(1), std::chrono::milliseconds(10), 0}, [&] {
+        bus.thermal.publish(thermalMonitor.getCurrentState());
+    });
+    scheduler.addTask({"metrics", std::chrono::seconds(10), std::chrono::milliseconds(50), 0}, [] {
+        Metrics::writeSnapshot("data/metrics/metrics.jsonl");
+    });
+    scheduler.addTask({"report", std::chrono::seconds(1), std::chrono::milliseconds(50), 0}, [&] {
+        float temp = 0.0f;
+        MPU6050Data mpuData{};
+        CameraFrame frame{};
+        bus.temperature.latest(temp);
+        bus.motion.latest(mpuData);
+        bus.frames.latest(frame);
+
         std::string log_entry = std::string("Temperature: ") + std::to_string(temp) + "°C\n" +
-                               std::string("MPU6050 - Accel(x,y,z): ") + 
-                               std::to_string(mpuData.accelX) + "," +
-                               std::to_string(mpuData.accelY) + "," +
-                               std::to_string(mpuData.accelZ) + "\n" +
-                               std::string("Camera frame size: ") + std::to_string(frame.size) + "\n";
-        
-        Logger::log("data/sensor_logs/sensor_data.txt", log_entry);
-        
+                                std::string("MPU6050 - Accel(x,y,z): ") +
+                                std::to_string(mpuData.accelX) + "," +
+                                std::to_string(mpuData.accelY) + "," +
+                                std::to_string(mpuData.accelZ) + "\n" +
+                                std::string("Camera frame size: ") + std::to_string(frame.size) + "\n";
+        Logger::log(sensorLog, log_entry);
+
+        for (size_t i = 0; i < scheduler.taskCount(); ++i) {
+            const SensorTaskStats& stats = scheduler.getStats(i);
+            log_entry += scheduler.getConfig(i).name + ": runs " + std::to_string(stats.runs.load()) +
+                         ", overruns " + std::to_string(stats.overruns.load()) +
+                         ", max jitter " + std::to_string(stats.max_jitter_ns.load() / 1000) + "us\n";
+        }
+
         // Display data
         std::cout << "\033[H\033[2J";  // Clear screen
         std::cout << log_entry;
-        
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+    });
+
+    scheduler.start();
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::hours(1));
     }
 }
-void resourceOptimization() {
+void resourceOptimization(TelemetryBus& bus, const ActuatorOptions& options) {
     CPUMonitor cpuMonitor;
     MemoryMonitor memMonitor;
     PowerMonitor powerMonitor;
-    Population population(10);
+    std::unique_ptr<CPUOptimizer> cpuOptimizer;
+    std::unique_ptr<MemoryOptimizer> memOptimizer;
+    if (!options.cgroup_dir.empty()) {
+        cpuOptimizer = std::make_unique<CPUOptimizer>(options.cgroup_dir);
+        memOptimizer = std::make_unique<MemoryOptimizer>(options.cgroup_dir);
+    }
+    PowerOptimizer powerOptimizer("/sys", options.power);
+    // Without a power sensor the readings are all 0 W and the GA would pull
+    // the clocks down to their minimum
+    bool powerMeasured = powerMonitor.sourceCount() != 0;
+    GeneticConfig gaConfig;
+    gaConfig.mode = EvolutionMode::SteadyState;
+    gaConfig.elite_count = 16;
+    Population population(10000, gaConfig);
+    LogSinkId optimizationLog = Logger::openSink("data/optimization_results/optimization_log.log");
+
+    // Say which actuators are live; a missing cgroup is otherwise a silent no-op
+    std::string actuators = "Actuators:\n";
+    if (cpuOptimizer) {
+        actuators += "CPU (" + options.cgroup_dir + "): cpu.max " +
+                     (cpuOptimizer->hasQuota() ? "yes" : "no") + ", cpuset.cpus " +
+                     (cpuOptimizer->hasCpuset() ? "yes" : "no") + "\n" +
+                     "Memory (" + options.cgroup_dir + "): memory.high " +
+                     (memOptimizer->isAttached() ? "yes" : "no") + "\n";
+    } else {
+        actuators += "CPU, Memory: off (no --cgroup)\n";
+    }
+    actuators += "Power: " + std::string(!options.power.enabled ? "off (no --power-actuation)"
+                                         : !powerMeasured ? "off (no power sensor)"
+                                         : std::to_string(powerOptimizer.policyCount()) + " cpufreq policies") + "\n";
+    Logger::log(optimizationLog, actuators);
+    std::cerr << actuators;
+    LatencyHistogram& cycleStage = Metrics::stage("optimizer.cycle");
+    LatencyHistogram& sampleStage = Metrics::stage("optimizer.sample");
+    LatencyHistogram& evolveStage = Metrics::stage("optimizer.evolve");
+    LatencyHistogram& actuateStage = Metrics::stage("optimizer.actuate");
+    LatencyHistogram& logStage = Metrics::stage("optimizer.log");
+
+    // The monitors primed themselves on construction; give every one of
+    // them a full period before the first reading is acted on
+    std::this_thread::sleep_for(std::chrono::seconds(1));
     
     while (true) {
+        uint64_t cycleStart = monotonicNs();
+
         // Get current resource usage
-        SystemResources current = {
-            cpuMonitor.getCurrentUsage(),
-            memMonitor.getCurrentUsage(),
-            powerMonitor.getCurrentUsage()
-        };
+        SystemResources current{};
+        {
+            ScopedTimer timer(sampleStage);
+            current = {
+                cpuMonitor.getCurrentUsage(),
+                memMonitor.getCurrentUsage(),
+                powerMonitor.getCurrentUsage()
+            };
+            ThermalState thermal;
+            if (bus.thermal.latest(thermal)) {
+                current.soc_temperature = thermal.soc_temperature;
+                current.throttled = thermal.throttled;
+            }
+            bus.resources.publish(current);
+            if (powerMeasured) {
+                powerOptimizer.observePower(current.power_usage);
+            }
+        }
+        // A 0% reading from an interval with no jiffies must not reach the
+        // GA or the actuators
+        if (!cpuMonitor.hasSample()) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            continue;
+        }
         
         // Evolve population and get best parameters
-        population.evolve();
-        Chromosome bestChromosome = population.getBestChromosome();
-        OptimizationParams params = bestChromosome.getParams();
+        OptimizationParams params;
+        {
+            ScopedTimer timer(evolveStage);
+            population.evolve(current);
+            params = population.getBestChromosome().getParams();
+        }
+
+        // Apply the best parameters; each optimizer rate-limits itself
+        {
+            ScopedTimer timer(actuateStage);
+            if (cpuOptimizer) {
+                cpuOptimizer->optimize(params.cpu_threshold);
+                memOptimizer->optimize(params.memory_threshold);
+            }
+            if (powerMeasured) {
+                powerOptimizer.optimize(params.power_threshold);
+            }
+        }
         
         // Log results using string concatenation with std::string
+        uint64_t logStart = monotonicNs();
         std::string log_entry = std::string("Current Usage:\n") +
                                std::string("CPU: ") + std::to_string(current.cpu_usage) + "%\n" +
                                std::string("Memory: ") + std::to_string(current.memory_usage) + "%\n" +
                                std::string("Power: ") + std::to_string(current.power_usage) + "W\n" +
+                               std::string("SoC: ") + std::to_string(current.soc_temperature) + "°C" +
+                               (current.throttled ? " (throttled)\n" : "\n") +
                                std::string("Optimized Parameters:\n") +
                                std::string("CPU Threshold: ") + std::to_string(params.cpu_threshold) + "%\n" +
                                std::string("Memory Threshold: ") + std::to_string(params.memory_threshold) + "%\n" +
                                std::string("Power Threshold: ") + std::to_string(params.power_threshold) + "W\n";
         
-        Logger::log("data/optimization_results/optimization_log.txt", log_entry);
+        Logger::log(optimizationLog, log_entry);
+        uint64_t cycleEnd = monotonicNs();
+        logStage.record(cycleEnd - logStart);
+        cycleStage.record(cycleEnd - cycleStart);
         
         std::this_thread::sleep_for(std::chrono::seconds(1));
     }
 }
-int main() {
-    std::thread sensorThread(sensorDataCollection);
-    std::thread optimizationThread(resourceOptimization);
+int main(int argc, char** argv) {
+    // Actuation is opt-in:
+    //   --cgroup DIR        cgroup v2 directory whose cpu.max, cpuset.cpus and
+    //                       memory.high are managed
+    //   --power-actuation   cpufreq limits, which apply to the whole system
+    //   --power-budget W    draw at full clock; without it the peak seen is used
+    ActuatorOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--cgroup" && i + 1 < argc) {
+            options.cgroup_dir = argv[++i];
+        } else if (arg == "--power-actuation") {
+            options.power.enabled = true;
+        } else if (arg == "--power-budget" && i + 1 < argc) {
+            options.power.max_power_watts = std::atof(argv[++i]);
+        } else {
+            std::cerr << "usage: " << argv[0]
+                      << " [--cgroup DIR] [--power-actuation] [--power-budget WATTS]\n";
+            return 1;
+        }
+    }
+
+    TelemetryBus bus;
+    std::thread sensorThread(sensorDataCollection, std::ref(bus));
+    std::thread optimizationThread(resourceOptimization, std::ref(bus), std::cref(options));
     
     sensorThread.join();
     optimizationThread.join();
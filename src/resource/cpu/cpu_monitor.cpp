@@ -0,0 +1,105 @@
+#include "resource/cpu/cpu_monitor.hpp"
+#include <algorithm>
+
+namespace {
+
+// Parses the counters following a "cpu"/"cpuN" tag. iowait counts as idle;
+// guest time is already included in user/nice.
+const char* parseJiffies(const char* p, uint64_t& busy, uint64_t& total) {
+    uint64_t fields[8] = {};
+    for (uint64_t& field : fields) {
+        p = parseUnsigned(p, field);
+    }
+    uint64_t idle = fields[3] + fields[4];
+    total = 0;
+    for (uint64_t field : fields) {
+        total += field;
+    }
+    busy = total - idle;
+    return p;
+}
+
+double percentOf(uint64_t busyDelta, uint64_t totalDelta) {
+    return totalDelta == 0 ? 0.0 : static_cast<double>(busyDelta) * 100.0 / static_cast<double>(totalDelta);
+}
+
+} // namespace
+
+CPUMonitor::CPUMonitor(const std::string& procRoot)
+    : statFile(procRoot + "/stat"),
+      pressureReader(procRoot + "/pressure/cpu") {
+    // Size the read buffer once so that every cpuN line fits; the rest of
+    // /proc/stat (intr, ctxt, ...) is not needed.
+    size_t cores = 0;
+    for (size_t capacity = 4096; statFile.isOpen(); capacity *= 2) {
+        buffer.assign(capacity, '\0');
+        long length = statFile.read(buffer.data(), buffer.size());
+        if (length < 0) {
+            break;
+        }
+
+        size_t linesEnd = 0;
+        bool truncated = false;
+        for (const char* p = buffer.data(); startsWith(p, "cpu"); p = skipLine(p)) {
+            const char* next = skipLine(p);
+            if (next[-1] != '\n') {
+                truncated = true;
+                break;
+            }
+            if (p[3] >= '0' && p[3] <= '9') {
+                uint64_t index;
+                parseUnsigned(p + 3, index);
+                cores = std::max<size_t>(cores, index + 1);
+            }
+            linesEnd = static_cast<size_t>(next - buffer.data());
+        }
+        if (!truncated || static_cast<size_t>(length) < capacity - 1) {
+            // Leave room for counters gaining digits.
+            buffer.assign(linesEnd + 64 * (cores + 1) + 1, '\0');
+            break;
+        }
+    }
+
+    lastCore.resize(cores);
+    coreUsage.resize(cores, 0.0);
+    sample();
+    usage = 0.0;
+    sampled = false;
+    std::fill(coreUsage.begin(), coreUsage.end(), 0.0);
+}
+
+double CPUMonitor::getCurrentUsage() {
+    sample();
+    return usage;
+}
+
+bool CPUMonitor::sample() {
+    pressureReader.sample(pressure);
+
+    if (buffer.empty() || statFile.read(buffer.data(), buffer.size()) <= 0) {
+        return false;
+    }
+
+    for (const char* p = buffer.data(); startsWith(p, "cpu"); p = skipLine(p)) {
+        uint64_t busy;
+        uint64_t total;
+        if (p[3] == ' ') {
+            parseJiffies(p + 3, busy, total);
+            usage = percentOf(busy - lastTotal.busy, total - lastTotal.total);
+            sampled = sampled || total > lastTotal.total;
+            lastTotal = {busy, total};
+            continue;
+        }
+
+        uint64_t index;
+        const char* fields = parseUnsigned(p + 3, index);
+        if (index >= lastCore.size()) {
+            continue;
+        }
+        parseJiffies(fields, busy, total);
+        Jiffies& last = lastCore[index];
+        coreUsage[index] = percentOf(busy - last.busy, total - last.total);
+        last = {busy, total};
+    }
+    return true;
+}
@@ -0,0 +1,69 @@
+#include "resource/cpu/cpu_optimizer.hpp"
+#include "utils/clock.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+
+namespace {
+
+constexpr uint64_t kCfsPeriodUs = 100000;
+constexpr uint64_t kMinQuotaUs = 1000;
+
+size_t countCores(const std::string& cpuDir) {
+    size_t count = 0;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(cpuDir, ec), end; !ec && it != end; it.increment(ec)) {
+        std::string name = it->path().filename().string();
+        if (name.size() > 3 && name.compare(0, 3, "cpu") == 0 &&
+            std::all_of(name.begin() + 3, name.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+CPUOptimizer::CPUOptimizer(const std::string& cgroupDir, const std::string& sysRoot,
+                           const ActuatorLimits& limits)
+    : gate(limits),
+      cores(countCores(sysRoot + "/devices/system/cpu")) {
+    if (cores == 0) {
+        cores = std::max(1u, std::thread::hardware_concurrency());
+    }
+    cpuMax = writer.attach(cgroupDir + "/cpu.max");
+    cpusetCpus = writer.attach(cgroupDir + "/cpuset.cpus");
+}
+
+void CPUOptimizer::optimize(double threshold) {
+    threshold = std::min(std::max(threshold, 0.0), 100.0);
+    if ((cpuMax < 0 && cpusetCpus < 0) || !gate.admit(threshold, monotonicNs())) {
+        return;
+    }
+    threshold = gate.applied();
+
+    double share = threshold / 100.0 * static_cast<double>(cores);
+    size_t usedCores = std::min(cores, std::max<size_t>(1, static_cast<size_t>(std::ceil(share))));
+
+    char value[SysfsWriter::kValueCapacity];
+    size_t firstCore = cores - usedCores;
+    if (usedCores == 1) {
+        std::snprintf(value, sizeof(value), "%zu", firstCore);
+    } else {
+        std::snprintf(value, sizeof(value), "%zu-%zu", firstCore, cores - 1);
+    }
+    writer.stage(cpusetCpus, value);
+
+    if (threshold >= 100.0) {
+        std::snprintf(value, sizeof(value), "max %llu", static_cast<unsigned long long>(kCfsPeriodUs));
+    } else {
+        uint64_t quota = std::max(kMinQuotaUs, static_cast<uint64_t>(share * kCfsPeriodUs));
+        std::snprintf(value, sizeof(value), "%llu %llu", static_cast<unsigned long long>(quota),
+                      static_cast<unsigned long long>(kCfsPeriodUs));
+    }
+    writer.stage(cpuMax, value);
+
+    writer.commit();
+}
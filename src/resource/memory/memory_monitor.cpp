@@ -0,0 +1,40 @@
+#include "resource/memory/memory_monitor.hpp"
+
+MemoryMonitor::MemoryMonitor(const std::string& procRoot)
+    : meminfoFile(procRoot + "/meminfo"),
+      pressureReader(procRoot + "/pressure/memory") {}
+
+double MemoryMonitor::getCurrentUsage() {
+    sample();
+    return usage;
+}
+
+bool MemoryMonitor::sample() {
+    pressureReader.sample(stats.pressure);
+
+    char buffer[8192];
+    if (meminfoFile.read(buffer, sizeof(buffer)) <= 0) {
+        return false;
+    }
+
+    bool haveAvailable = false;
+    for (const char* p = buffer; *p != '\0'; p = skipLine(p)) {
+        if (startsWith(p, "MemTotal:")) {
+            parseUnsigned(p + 9, stats.total_kb);
+        } else if (startsWith(p, "MemAvailable:")) {
+            parseUnsigned(p + 13, stats.available_kb);
+            haveAvailable = true;
+        } else if (startsWith(p, "SwapTotal:")) {
+            parseUnsigned(p + 10, stats.swap_total_kb);
+        } else if (startsWith(p, "SwapFree:")) {
+            parseUnsigned(p + 9, stats.swap_free_kb);
+        }
+    }
+    if (!haveAvailable || stats.total_kb == 0) {
+        return false;
+    }
+
+    uint64_t used = stats.total_kb > stats.available_kb ? stats.total_kb - stats.available_kb : 0;
+    usage = static_cast<double>(used) * 100.0 / static_cast<double>(stats.total_kb);
+    return true;
+}
@@ -0,0 +1,43 @@
+#include "resource/memory/memory_optimizer.hpp"
+#include "utils/clock.hpp"
+#include "utils/proc_file.hpp"
+#include <algorithm>
+
+namespace {
+
+constexpr uint64_t kPageSize = 4096;
+
+} // namespace
+
+MemoryOptimizer::MemoryOptimizer(const std::string& cgroupDir, const std::string& procRoot,
+                                 const ActuatorLimits& limits)
+    : gate(limits) {
+    char buffer[8192];
+    if (ProcFile(procRoot + "/meminfo").read(buffer, sizeof(buffer)) > 0) {
+        for (const char* p = buffer; *p != '\0'; p = skipLine(p)) {
+            if (startsWith(p, "MemTotal:")) {
+                uint64_t totalKb;
+                parseUnsigned(p + 9, totalKb);
+                total = totalKb * 1024;
+                break;
+            }
+        }
+    }
+    memoryHigh = total != 0 ? writer.attach(cgroupDir + "/memory.high") : -1;
+}
+
+void MemoryOptimizer::optimize(double threshold) {
+    threshold = std::min(std::max(threshold, 0.0), 100.0);
+    if (memoryHigh < 0 || !gate.admit(threshold, monotonicNs())) {
+        return;
+    }
+    threshold = gate.applied();
+
+    if (threshold >= 100.0) {
+        writer.stage(memoryHigh, "max");
+    } else {
+        uint64_t bytes = static_cast<uint64_t>(static_cast<double>(total) * threshold / 100.0);
+        writer.stage(memoryHigh, std::max(kPageSize, bytes / kPageSize * kPageSize));
+    }
+    writer.commit();
+}
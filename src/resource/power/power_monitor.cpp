@@ -0,0 +1,98 @@
+#include "resource/power/power_monitor.hpp"
+#include "utils/clock.hpp"
+#include <cstdlib>
+#include <filesystem>
+
+namespace {
+
+bool exists(const std::string& path) {
+    std::error_code ec;
+    return std::filesystem::exists(path, ec);
+}
+
+std::vector<std::string> subdirectories(const std::string& dir) {
+    std::vector<std::string> entries;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        entries.push_back(it->path().string());
+    }
+    return entries;
+}
+
+} // namespace
+
+PowerMonitor::PowerMonitor(const std::string& sysRoot) {
+    for (const std::string& dir : subdirectories(sysRoot + "/class/hwmon")) {
+        addHwmon(dir);
+    }
+    for (const std::string& dir : subdirectories(sysRoot + "/class/power_supply")) {
+        addPowerSupply(dir);
+    }
+    for (Source& source : sources) {
+        sample(source);
+    }
+}
+
+// hwmon units: energy in microjoules, power in microwatts, voltage in
+// millivolts and current in milliamps.
+void PowerMonitor::addHwmon(const std::string& dir) {
+    if (exists(dir + "/energy1_input")) {
+        sources.push_back({SourceKind::Energy, ProcFile(dir + "/energy1_input"), ProcFile(), 1e-6});
+    } else if (exists(dir + "/power1_input")) {
+        sources.push_back({SourceKind::Power, ProcFile(dir + "/power1_input"), ProcFile(), 1e-6});
+    } else if (exists(dir + "/in1_input") && exists(dir + "/curr1_input")) {
+        sources.push_back({SourceKind::VoltageCurrent, ProcFile(dir + "/in1_input"),
+                           ProcFile(dir + "/curr1_input"), 1e-6});
+    }
+}
+
+// power_supply units: power in microwatts, voltage in microvolts and
+// current in microamps.
+void PowerMonitor::addPowerSupply(const std::string& dir) {
+    if (exists(dir + "/power_now")) {
+        sources.push_back({SourceKind::Power, ProcFile(dir + "/power_now"), ProcFile(), 1e-6});
+    } else if (exists(dir + "/voltage_now") && exists(dir + "/current_now")) {
+        sources.push_back({SourceKind::VoltageCurrent, ProcFile(dir + "/voltage_now"),
+                           ProcFile(dir + "/current_now"), 1e-12});
+    }
+}
+
+double PowerMonitor::getCurrentUsage() {
+    double total = 0.0;
+    for (Source& source : sources) {
+        sample(source);
+        total += source.watts;
+    }
+    return total;
+}
+
+void PowerMonitor::sample(Source& source) {
+    int64_t primary;
+    if (!source.primary.readInteger(primary)) {
+        return;
+    }
+
+    switch (source.kind) {
+    case SourceKind::Energy: {
+        uint64_t now = monotonicNs();
+        if (source.lastSampleNs != 0 && now > source.lastSampleNs && primary >= source.lastEnergy) {
+            double joules = static_cast<double>(primary - source.lastEnergy) * source.scale;
+            source.watts = joules * 1e9 / static_cast<double>(now - source.lastSampleNs);
+        }
+        source.lastEnergy = primary;
+        source.lastSampleNs = now;
+        break;
+    }
+    case SourceKind::Power:
+        source.watts = static_cast<double>(std::llabs(primary)) * source.scale;
+        break;
+    case SourceKind::VoltageCurrent: {
+        int64_t secondary;
+        if (source.secondary.readInteger(secondary)) {
+            source.watts = static_cast<double>(std::llabs(primary)) *
+                           static_cast<double>(std::llabs(secondary)) * source.scale;
+        }
+        break;
+    }
+    }
+}
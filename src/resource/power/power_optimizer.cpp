@@ -0,0 +1,131 @@
+#include "resource/power/power_optimizer.hpp"
+#include "utils/clock.hpp"
+#include "utils/proc_file.hpp"
+#include <algorithm>
+#include <filesystem>
+
+namespace {
+
+bool readUnsigned(const std::string& path, uint64_t& value) {
+    int64_t raw;
+    if (!ProcFile(path).readInteger(raw) || raw < 0) {
+        return false;
+    }
+    value = static_cast<uint64_t>(raw);
+    return true;
+}
+
+std::string readText(const std::string& path) {
+    char buffer[512];
+    return ProcFile(path).read(buffer, sizeof(buffer)) > 0 ? std::string(buffer) : std::string();
+}
+
+bool offers(const std::string& governors, const std::string& name) {
+    if (name.empty()) {
+        return false;
+    }
+    for (size_t pos = governors.find(name); pos != std::string::npos; pos = governors.find(name, pos + 1)) {
+        bool startOk = pos == 0 || governors[pos - 1] == ' ';
+        size_t end = pos + name.size();
+        bool endOk = end == governors.size() || governors[end] == ' ' || governors[end] == '\n';
+        if (startOk && endOk) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+PowerOptimizer::PowerOptimizer(const std::string& sysRoot, const PowerOptimizerConfig& config,
+                               const ActuatorLimits& limits)
+    : config(config), gate(limits) {
+    std::vector<std::string> dirs;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(sysRoot + "/devices/system/cpu/cpufreq", ec), end;
+         !ec && it != end; it.increment(ec)) {
+        if (it->path().filename().string().compare(0, 6, "policy") == 0) {
+            dirs.push_back(it->path().string());
+        }
+    }
+    std::sort(dirs.begin(), dirs.end());
+
+    for (const std::string& dir : dirs) {
+        Policy policy;
+        if (!readUnsigned(dir + "/cpuinfo_max_freq", policy.maxKhz)) {
+            continue;
+        }
+        // scaling_max_freq may not go below scaling_min_freq.
+        if (!readUnsigned(dir + "/scaling_min_freq", policy.minKhz) &&
+            !readUnsigned(dir + "/cpuinfo_min_freq", policy.minKhz)) {
+            policy.minKhz = 0;
+        }
+
+        std::string frequencies = readText(dir + "/scaling_available_frequencies");
+        for (const char* p = frequencies.c_str(); *p != '\0';) {
+            uint64_t khz;
+            const char* next = parseUnsigned(p, khz);
+            if (next == skipSpaces(p)) {
+                break;
+            }
+            if (khz >= policy.minKhz && khz <= policy.maxKhz) {
+                policy.available.push_back(khz);
+            }
+            p = skipSpaces(next);
+        }
+        std::sort(policy.available.begin(), policy.available.end());
+
+        policy.availableGovernors = readText(dir + "/scaling_available_governors");
+        policy.maxFreq = writer.attach(dir + "/scaling_max_freq");
+        policy.governor = writer.attach(dir + "/scaling_governor");
+        policies.push_back(std::move(policy));
+    }
+}
+
+void PowerOptimizer::observePower(double watts) {
+    peakWatts = std::max(peakWatts, watts);
+}
+
+double PowerOptimizer::fullPowerWatts() const {
+    return config.max_power_watts > 0.0 ? config.max_power_watts : peakWatts;
+}
+
+void PowerOptimizer::optimize(double threshold) {
+    threshold = std::max(threshold, 0.0);
+    double fullWatts = fullPowerWatts();
+    if (!config.enabled || policies.empty() || fullWatts <= 0.0 ||
+        !gate.admit(threshold, monotonicNs())) {
+        return;
+    }
+    threshold = gate.applied();
+
+    double fraction = std::min(threshold / fullWatts, 1.0);
+    for (const Policy& policy : policies) {
+        uint64_t target = policy.minKhz + static_cast<uint64_t>(
+            fraction * static_cast<double>(policy.maxKhz - std::min(policy.minKhz, policy.maxKhz)));
+        if (!policy.available.empty()) {
+            // Highest available frequency that stays within the budget.
+            auto it = std::upper_bound(policy.available.begin(), policy.available.end(), target);
+            target = it == policy.available.begin() ? policy.available.front() : *(it - 1);
+        }
+
+        const char* governor = pickGovernor(policy, threshold);
+        if (governor != nullptr) {
+            writer.stage(policy.governor, governor);
+        }
+        writer.stage(policy.maxFreq, target);
+    }
+    writer.commit();
+}
+
+const char* PowerOptimizer::pickGovernor(const Policy& policy, double watts) const {
+    const std::string& preferred = watts < config.low_power_watts ? config.low_power_governor
+                                                                  : config.governor;
+    if (offers(policy.availableGovernors, preferred)) {
+        return preferred.c_str();
+    }
+    if (offers(policy.availableGovernors, config.fallback_governor)) {
+        return config.fallback_governor.c_str();
+    }
+    return nullptr;
+}
@@ -0,0 +1,65 @@
+#include "resource/pressure_reader.hpp"
+#include "utils/clock.hpp"
+
+namespace {
+
+// Parses "avg10=X avg60=Y avg300=Z total=N" following the some/full tag.
+bool parsePressureLine(const char* p, double& avg10, uint64_t& totalUs) {
+    bool haveAvg = false;
+    bool haveTotal = false;
+    while (*p != '\0' && *p != '\n') {
+        p = skipSpaces(p);
+        if (startsWith(p, "avg10=")) {
+            p = parseDecimal(p + 6, avg10);
+            haveAvg = true;
+        } else if (startsWith(p, "total=")) {
+            p = parseUnsigned(p + 6, totalUs);
+            haveTotal = true;
+        } else {
+            while (*p != '\0' && *p != '\n' && *p != ' ') {
+                ++p;
+            }
+        }
+    }
+    return haveAvg && haveTotal;
+}
+
+} // namespace
+
+PressureReader::PressureReader(const std::string& path) : file(path) {
+    PressureStats ignored;
+    sample(ignored);
+}
+
+bool PressureReader::sample(PressureStats& stats) {
+    char buffer[256];
+    if (file.read(buffer, sizeof(buffer)) <= 0) {
+        return false;
+    }
+
+    uint64_t someUs = 0;
+    uint64_t fullUs = 0;
+    bool haveSome = false;
+    bool haveFull = false;
+    for (const char* p = buffer; *p != '\0'; p = skipLine(p)) {
+        if (startsWith(p, "some ")) {
+            haveSome = parsePressureLine(p + 5, stats.some_avg10, someUs);
+        } else if (startsWith(p, "full ")) {
+            haveFull = parsePressureLine(p + 5, stats.full_avg10, fullUs);
+        }
+    }
+    if (!haveSome) {
+        return false;
+    }
+
+    uint64_t now = monotonicNs();
+    if (lastSampleNs != 0 && now > lastSampleNs) {
+        double elapsedUs = static_cast<double>(now - lastSampleNs) / 1000.0;
+        stats.some_stall_pct = static_cast<double>(someUs - lastSomeUs) * 100.0 / elapsedUs;
+        stats.full_stall_pct = haveFull ? static_cast<double>(fullUs - lastFullUs) * 100.0 / elapsedUs : 0.0;
+    }
+    lastSomeUs = someUs;
+    lastFullUs = fullUs;
+    lastSampleNs = now;
+    return true;
+}
@@ -0,0 +1,52 @@
+#include "resource/thermal/thermal_monitor.hpp"
+#include <cstdint>
+
+namespace {
+
+// get_throttled bits that mean the clocks are limited right now:
+// ARM frequency capped, throttled, soft temperature limit active.
+constexpr uint64_t kThrottledNowMask = 0x2 | 0x4 | 0x8;
+
+bool parseHex(const char* p, uint64_t& value) {
+    p = skipSpaces(p);
+    if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+        p += 2;
+    }
+    value = 0;
+    bool any = false;
+    for (;; ++p, any = true) {
+        char c = *p;
+        if (c >= '0' && c <= '9') {
+            value = (value << 4) | static_cast<uint64_t>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            value = (value << 4) | static_cast<uint64_t>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            value = (value << 4) | static_cast<uint64_t>(c - 'A' + 10);
+        } else {
+            return any;
+        }
+    }
+}
+
+} // namespace
+
+ThermalMonitor::ThermalMonitor(const std::string& sysRoot, double throttleCelsius)
+    : zoneTemp(sysRoot + "/class/thermal/thermal_zone0/temp"),
+      throttledFlags(sysRoot + "/devices/platform/soc/soc:firmware/get_throttled"),
+      throttleCelsius(throttleCelsius) {}
+
+ThermalState ThermalMonitor::getCurrentState() {
+    int64_t milliCelsius;
+    if (zoneTemp.readInteger(milliCelsius)) {
+        state.soc_temperature = static_cast<double>(milliCelsius) / 1000.0;
+    }
+
+    char buffer[32];
+    uint64_t flags;
+    if (throttledFlags.read(buffer, sizeof(buffer)) > 0 && parseHex(buffer, flags)) {
+        state.throttled = (flags & kThrottledNowMask) != 0;
+    } else {
+        state.throttled = state.soc_temperature >= throttleCelsius;
+    }
+    return state;
+}
@@ -0,0 +1,7 @@
+#!/bin/sh
+# Builds the project and runs the unit tests through ctest.
+set -e
+cd "$(dirname "$0")/../.."
+cmake -S . -B build/tests
+cmake --build build/tests -j"$(nproc)"
+ctest --test-dir build/tests --output-on-failure
@@ -1,5 +1,57 @@
 #include "sensors/camera/camera_capture.hpp"
+#include "sensors/camera/file_backend.hpp"
+#include "sensors/camera/synthetic_backend.hpp"
+#include "sensors/camera/v4l2_backend.hpp"
+#include <unistd.h>
+
+namespace {
+
+// Falls back to the synthetic pattern only when there is no device node at
+// all; a device that exists but fails to start leaves the capture closed.
+CameraConfig resolveBackend(CameraConfig config) {
+    if (config.backend == CameraBackend::Auto) {
+        config.backend = ::access(config.device.c_str(), F_OK) == 0 ? CameraBackend::V4L2
+                                                                    : CameraBackend::Synthetic;
+    }
+    return config;
+}
+
+std::unique_ptr<CaptureBackend> makeBackend(CameraBackend kind) {
+    switch (kind) {
+    case CameraBackend::File:
+        return std::make_unique<FileBackend>();
+    case CameraBackend::V4L2:
+        return std::make_unique<V4L2Backend>();
+    case CameraBackend::Auto:
+    case CameraBackend::Synthetic:
+        break;
+    }
+    return std::make_unique<SyntheticBackend>();
+}
+
+} // namespace
+
+CameraCapture::CameraCapture(const CameraConfig& config)
+    : config(resolveBackend(config)),
+      backend(makeBackend(this->config.backend)),
+      pool(backend.get()) {
+    open = backend->start(this->config, pool);
+}
 
 CameraFrame CameraCapture::captureFrame() {
-    return CameraFrame{640, 480, 640 * 480};
-}
\ No newline at end of file
+    FrameView frame = acquireFrame();
+    return frame ? frame.info() : CameraFrame{};
+}
+
+FrameView CameraCapture::acquireFrame() {
+    if (!open) {
+        return FrameView();
+    }
+    CameraFrame info;
+    int32_t index = backend->capture(pool, info, stats.dropped);
+    if (index < 0) {
+        return FrameView();
+    }
+    ++stats.delivered;
+    return pool.publish(static_cast<uint32_t>(index), info);
+}
@@ -0,0 +1,63 @@
+#include "sensors/camera/file_backend.hpp"
+#include "utils/clock.hpp"
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FileBackend::~FileBackend() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+bool FileBackend::start(CameraConfig& newConfig, FramePool& pool) {
+    config = newConfig;
+    frameBytes = static_cast<size_t>(config.width) * config.height * config.bytes_per_pixel;
+
+    fd = ::open(config.file.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    if (fd < 0 || ::fstat(fd, &st) != 0 || frameBytes == 0) {
+        return false;
+    }
+    frameCount = static_cast<size_t>(st.st_size) / frameBytes;
+    if (frameCount == 0) {
+        return false;
+    }
+
+    pool.allocate(config.buffer_count, frameBytes);
+    return true;
+}
+
+int32_t FileBackend::capture(FramePool& pool, CameraFrame& info, uint64_t& dropped) {
+    uint64_t frameSequence = sequence++;
+    int32_t index = pool.tryAcquire();
+    if (index < 0) {
+        ++dropped;
+        return -1;
+    }
+
+    // Read straight into the pooled buffer.
+    uint8_t* pixels = pool.buffer(static_cast<uint32_t>(index));
+    off_t offset = static_cast<off_t>((frameSequence % frameCount) * frameBytes);
+    size_t filled = 0;
+    while (filled < frameBytes) {
+        ssize_t n = ::pread(fd, pixels + filled, frameBytes - filled, offset + static_cast<off_t>(filled));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            pool.abandon(static_cast<uint32_t>(index));
+            ++dropped;
+            return -1;
+        }
+        filled += static_cast<size_t>(n);
+    }
+
+    info.width = config.width;
+    info.height = config.height;
+    info.size = frameBytes;
+    info.sequence = frameSequence;
+    info.timestamp_ns = monotonicNs();
+    return index;
+}
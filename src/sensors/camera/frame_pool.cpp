@@ -0,0 +1,102 @@
+#include "sensors/camera/frame_pool.hpp"
+#include <cstdlib>
+#include <utility>
+
+namespace {
+
+constexpr size_t kBufferAlignment = 64;
+
+} // namespace
+
+FrameView::FrameView(const FrameView& other) : pool(other.pool), index(other.index) {
+    if (pool != nullptr) {
+        pool->retain(index);
+    }
+}
+
+FrameView::FrameView(FrameView&& other) noexcept : pool(other.pool), index(other.index) {
+    other.pool = nullptr;
+}
+
+FrameView& FrameView::operator=(FrameView other) noexcept {
+    std::swap(pool, other.pool);
+    std::swap(index, other.index);
+    return *this;
+}
+
+FrameView::~FrameView() {
+    if (pool != nullptr) {
+        pool->release(index);
+    }
+}
+
+const uint8_t* FrameView::data() const {
+    return pool->slots[index].data;
+}
+
+size_t FrameView::size() const {
+    return pool->slots[index].info.size;
+}
+
+const CameraFrame& FrameView::info() const {
+    return pool->slots[index].info;
+}
+
+FramePool::~FramePool() {
+    if (owned) {
+        for (size_t i = 0; i < count; ++i) {
+            std::free(slots[i].data);
+        }
+    }
+}
+
+void FramePool::allocate(size_t newCount, size_t newBytes) {
+    size_t rounded = (newBytes + kBufferAlignment - 1) / kBufferAlignment * kBufferAlignment;
+    slots.reset(new Slot[newCount]);
+    for (size_t i = 0; i < newCount; ++i) {
+        slots[i].data = static_cast<uint8_t*>(std::aligned_alloc(kBufferAlignment, rounded));
+    }
+    count = newCount;
+    bytes = newBytes;
+    owned = true;
+}
+
+void FramePool::adopt(size_t newCount, uint8_t* const* buffers, size_t newBytes) {
+    slots.reset(new Slot[newCount]);
+    for (size_t i = 0; i < newCount; ++i) {
+        slots[i].data = buffers[i];
+    }
+    count = newCount;
+    bytes = newBytes;
+    owned = false;
+}
+
+int32_t FramePool::tryAcquire() {
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t expected = 0;
+        if (slots[i].refs.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+void FramePool::claim(uint32_t index) {
+    slots[index].refs.store(1, std::memory_order_relaxed);
+}
+
+FrameView FramePool::publish(uint32_t index, const CameraFrame& info) {
+    slots[index].info = info;
+    // The producer's claim becomes the returned view's reference.
+    return FrameView(this, index);
+}
+
+void FramePool::retain(uint32_t index) {
+    slots[index].refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FramePool::release(uint32_t index) {
+    if (slots[index].refs.fetch_sub(1, std::memory_order_acq_rel) == 1 && recycler != nullptr) {
+        recycler->recycle(index);
+    }
+}
@@ -0,0 +1,32 @@
+#include "sensors/camera/synthetic_backend.hpp"
+#include "utils/clock.hpp"
+#include <cstring>
+
+bool SyntheticBackend::start(CameraConfig& newConfig, FramePool& pool) {
+    config = newConfig;
+    pool.allocate(config.buffer_count,
+                  static_cast<size_t>(config.width) * config.height * config.bytes_per_pixel);
+    return true;
+}
+
+int32_t SyntheticBackend::capture(FramePool& pool, CameraFrame& info, uint64_t& dropped) {
+    uint64_t frameSequence = sequence++;
+    int32_t index = pool.tryAcquire();
+    if (index < 0) {
+        ++dropped;
+        return -1;
+    }
+
+    uint8_t* pixels = pool.buffer(static_cast<uint32_t>(index));
+    size_t rowBytes = static_cast<size_t>(config.width) * config.bytes_per_pixel;
+    for (int row = 0; row < config.height; ++row) {
+        std::memset(pixels + row * rowBytes, static_cast<int>((row + frameSequence) & 0xFF), rowBytes);
+    }
+
+    info.width = config.width;
+    info.height = config.height;
+    info.size = rowBytes * config.height;
+    info.sequence = frameSequence;
+    info.timestamp_ns = monotonicNs();
+    return index;
+}
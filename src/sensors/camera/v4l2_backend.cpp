@@ -0,0 +1,132 @@
+#include "sensors/camera/v4l2_backend.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/videodev2.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+int xioctl(int fd, unsigned long request, void* arg) {
+    int result;
+    do {
+        result = ::ioctl(fd, request, arg);
+    } while (result < 0 && errno == EINTR);
+    return result;
+}
+
+} // namespace
+
+V4L2Backend::~V4L2Backend() {
+    if (streaming) {
+        int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        xioctl(fd, VIDIOC_STREAMOFF, &type);
+    }
+    for (const Mapping& mapping : mappings) {
+        ::munmap(mapping.data, mapping.length);
+    }
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+bool V4L2Backend::start(CameraConfig& newConfig, FramePool& pool) {
+    fd = ::open(newConfig.device.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    v4l2_format format{};
+    format.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    format.fmt.pix.width = static_cast<uint32_t>(newConfig.width);
+    format.fmt.pix.height = static_cast<uint32_t>(newConfig.height);
+    format.fmt.pix.pixelformat = newConfig.pixel_format;
+    format.fmt.pix.field = V4L2_FIELD_NONE;
+    if (xioctl(fd, VIDIOC_S_FMT, &format) < 0) {
+        return false;
+    }
+    // The driver may have picked the nearest supported size.
+    newConfig.width = static_cast<int>(format.fmt.pix.width);
+    newConfig.height = static_cast<int>(format.fmt.pix.height);
+    newConfig.pixel_format = format.fmt.pix.pixelformat;
+
+    v4l2_requestbuffers request{};
+    request.count = static_cast<uint32_t>(newConfig.buffer_count);
+    request.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    request.memory = V4L2_MEMORY_MMAP;
+    if (xioctl(fd, VIDIOC_REQBUFS, &request) < 0 || request.count == 0) {
+        return false;
+    }
+    newConfig.buffer_count = request.count;
+
+    std::vector<uint8_t*> buffers;
+    for (uint32_t i = 0; i < request.count; ++i) {
+        v4l2_buffer buffer{};
+        buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buffer.memory = V4L2_MEMORY_MMAP;
+        buffer.index = i;
+        if (xioctl(fd, VIDIOC_QUERYBUF, &buffer) < 0) {
+            return false;
+        }
+        void* data = ::mmap(nullptr, buffer.length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, buffer.m.offset);
+        if (data == MAP_FAILED) {
+            return false;
+        }
+        mappings.push_back({static_cast<uint8_t*>(data), buffer.length});
+        buffers.push_back(static_cast<uint8_t*>(data));
+        if (xioctl(fd, VIDIOC_QBUF, &buffer) < 0) {
+            return false;
+        }
+    }
+    pool.adopt(buffers.size(), buffers.data(), format.fmt.pix.sizeimage);
+
+    int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (xioctl(fd, VIDIOC_STREAMON, &type) < 0) {
+        return false;
+    }
+    streaming = true;
+    config = newConfig;
+    return true;
+}
+
+int32_t V4L2Backend::capture(FramePool& pool, CameraFrame& info, uint64_t& dropped) {
+    pollfd pfd{fd, POLLIN, 0};
+    if (::poll(&pfd, 1, config.timeout_ms) <= 0) {
+        return -1;
+    }
+
+    v4l2_buffer buffer{};
+    buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buffer.memory = V4L2_MEMORY_MMAP;
+    if (xioctl(fd, VIDIOC_DQBUF, &buffer) < 0) {
+        return -1;
+    }
+
+    // When consumers hold every buffer the driver has nowhere to write and
+    // skips frames; the gap shows up in the sequence numbers.
+    if (haveSequence && buffer.sequence > lastSequence + 1) {
+        dropped += buffer.sequence - lastSequence - 1;
+    }
+    haveSequence = true;
+    lastSequence = buffer.sequence;
+
+    pool.claim(buffer.index);
+    info.width = config.width;
+    info.height = config.height;
+    info.size = buffer.bytesused;
+    info.sequence = buffer.sequence;
+    info.timestamp_ns = static_cast<uint64_t>(buffer.timestamp.tv_sec) * 1000000000ull +
+                        static_cast<uint64_t>(buffer.timestamp.tv_usec) * 1000ull;
+    return static_cast<int32_t>(buffer.index);
+}
+
+void V4L2Backend::recycle(uint32_t index) {
+    v4l2_buffer buffer{};
+    buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buffer.memory = V4L2_MEMORY_MMAP;
+    buffer.index = index;
+    xioctl(fd, VIDIOC_QBUF, &buffer);
+}
@@ -0,0 +1,105 @@
+#include "sensors/mpu6050/i2c_imu_fifo.hpp"
+#include <algorithm>
+#include <fcntl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr uint8_t kSmplrtDiv = 0x19;
+constexpr uint8_t kConfig = 0x1A;
+constexpr uint8_t kGyroConfig = 0x1B;
+constexpr uint8_t kAccelConfig = 0x1C;
+constexpr uint8_t kFifoEn = 0x23;
+constexpr uint8_t kIntStatus = 0x3A;
+constexpr uint8_t kUserCtrl = 0x6A;
+constexpr uint8_t kPwrMgmt1 = 0x6B;
+constexpr uint8_t kFifoCountH = 0x72;
+constexpr uint8_t kFifoRw = 0x74;
+
+constexpr uint8_t kFifoEnAccelGyro = 0x78;   // XG, YG, ZG and ACCEL
+constexpr uint8_t kUserCtrlFifoEn = 0x40;
+constexpr uint8_t kUserCtrlFifoReset = 0x04;
+constexpr uint8_t kIntFifoOverflow = 0x10;
+
+} // namespace
+
+I2CImuFifo::I2CImuFifo(const std::string& bus, uint8_t address, uint32_t sampleRateHz)
+    : address(address) {
+    // With the DLPF enabled the gyro output rate is 1 kHz.
+    sampleRateHz = std::min(std::max(sampleRateHz, 4u), 1000u);
+    uint8_t divider = static_cast<uint8_t>(1000 / sampleRateHz - 1);
+    periodNs = 1000000u * (divider + 1u);
+
+    fd = ::open(bus.c_str(), O_RDWR | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    bool ok = writeRegister(kPwrMgmt1, 0x01) &&        // wake up, PLL with gyro X reference
+              writeRegister(kConfig, 0x01) &&          // DLPF 184 Hz
+              writeRegister(kSmplrtDiv, divider) &&
+              writeRegister(kGyroConfig, 0x00) &&      // ±250 deg/s
+              writeRegister(kAccelConfig, 0x00) &&     // ±2 g
+              writeRegister(kFifoEn, kFifoEnAccelGyro);
+    if (!ok) {
+        ::close(fd);
+        fd = -1;
+        return;
+    }
+    resetFifo();
+}
+
+I2CImuFifo::~I2CImuFifo() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+size_t I2CImuFifo::read(uint8_t* buffer, size_t capacity) {
+    if (fd < 0) {
+        return 0;
+    }
+
+    uint8_t status;
+    if (readRegisters(kIntStatus, &status, 1) && (status & kIntFifoOverflow)) {
+        // The FIFO wrapped and its contents are misaligned; start over.
+        overflowCount += kMpu6050FifoBytes / kMpu6050SampleBytes;
+        resetFifo();
+        return 0;
+    }
+
+    uint8_t countBytes[2];
+    if (!readRegisters(kFifoCountH, countBytes, 2)) {
+        return 0;
+    }
+    size_t available = (static_cast<size_t>(countBytes[0]) << 8) | countBytes[1];
+    size_t length = std::min(available, capacity);
+    length -= length % kMpu6050SampleBytes;
+    if (length == 0 || !readRegisters(kFifoRw, buffer, length)) {
+        return 0;
+    }
+    return length;
+}
+
+bool I2CImuFifo::writeRegister(uint8_t reg, uint8_t value) {
+    uint8_t data[2] = {reg, value};
+    i2c_msg message{address, 0, 2, data};
+    i2c_rdwr_ioctl_data transfer{&message, 1};
+    return ::ioctl(fd, I2C_RDWR, &transfer) >= 0;
+}
+
+bool I2CImuFifo::readRegisters(uint8_t reg, uint8_t* out, size_t length) {
+    i2c_msg messages[2] = {
+        {address, 0, 1, &reg},
+        {address, I2C_M_RD, static_cast<uint16_t>(length), out},
+    };
+    i2c_rdwr_ioctl_data transfer{messages, 2};
+    return ::ioctl(fd, I2C_RDWR, &transfer) >= 0;
+}
+
+void I2CImuFifo::resetFifo() {
+    writeRegister(kUserCtrl, kUserCtrlFifoReset);
+    writeRegister(kUserCtrl, kUserCtrlFifoEn);
+}
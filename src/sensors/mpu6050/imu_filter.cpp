@@ -0,0 +1,120 @@
+#include "sensors/mpu6050/imu_filter.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr float kRadToDeg = 57.29577951308232f;
+
+} // namespace
+
+ImuFilter::ImuFilter(const ImuFilterConfig& config) : config(config) {
+    this->config.decimation = std::max<size_t>(config.decimation, 1);
+}
+
+void ImuFilter::calibrate(ImuBatch& batch) const {
+    size_t count = batch.count;
+    for (size_t c = 0; c < kImuChannelCount; ++c) {
+        float* __restrict x = batch.channels[c];
+        const float bias = calibration.bias[c];
+        const float scale = calibration.scale[c];
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = (x[i] - bias) * scale;
+        }
+    }
+}
+
+void ImuFilter::lowPass(ImuBatch& batch) {
+    if (batch.count == 0) {
+        return;
+    }
+    if (!primed) {
+        for (size_t c = 0; c < kImuChannelCount; ++c) {
+            lowpassState[c] = batch.channels[c][0];
+        }
+        primed = true;
+    }
+
+    const float alpha = config.lowpass_alpha;
+    for (size_t c = 0; c < kImuChannelCount; ++c) {
+        float* x = batch.channels[c];
+        float y = lowpassState[c];
+        for (size_t i = 0; i < batch.count; ++i) {
+            y += alpha * (x[i] - y);
+            x[i] = y;
+        }
+        lowpassState[c] = y;
+    }
+}
+
+void ImuFilter::complementary(const ImuBatch& batch) {
+    size_t count = batch.count;
+    if (count == 0) {
+        return;
+    }
+
+    const float* __restrict ax = batch.channels[kAccelX];
+    const float* __restrict ay = batch.channels[kAccelY];
+    const float* __restrict az = batch.channels[kAccelZ];
+    for (size_t i = 0; i < count; ++i) {
+        accelPitch[i] = std::atan2(-ax[i], std::sqrt(ay[i] * ay[i] + az[i] * az[i])) * kRadToDeg;
+        accelRoll[i] = std::atan2(ay[i], az[i]) * kRadToDeg;
+    }
+
+    if (!orientationPrimed) {
+        pitch = accelPitch[0];
+        roll = accelRoll[0];
+        orientationPrimed = true;
+    }
+
+    const float* gx = batch.channels[kGyroX];
+    const float* gy = batch.channels[kGyroY];
+    const float dt = static_cast<float>(batch.sample_period_ns) * 1e-9f;
+    const float a = config.complementary_alpha;
+    for (size_t i = 0; i < count; ++i) {
+        pitch = a * (pitch + gy[i] * dt) + (1.0f - a) * accelPitch[i];
+        roll = a * (roll + gx[i] * dt) + (1.0f - a) * accelRoll[i];
+    }
+}
+
+void ImuFilter::decimate(const ImuBatch& batch, ImuBatch& out) {
+    const size_t factor = config.decimation;
+    const float inverse = 1.0f / static_cast<float>(factor);
+    size_t pendingAfter = decimationCount;
+    size_t outCount = out.count;
+
+    for (size_t c = 0; c < kImuChannelCount; ++c) {
+        const float* x = batch.channels[c];
+        float* y = out.channels[c];
+        float sum = decimationSum[c];
+        size_t pending = decimationCount;
+        size_t o = out.count;
+        for (size_t i = 0; i < batch.count; ++i) {
+            sum += x[i];
+            if (++pending == factor) {
+                if (o < kImuBatchCapacity) {
+                    y[o++] = sum * inverse;
+                }
+                sum = 0.0f;
+                pending = 0;
+            }
+        }
+        decimationSum[c] = sum;
+        pendingAfter = pending;
+        outCount = o;
+    }
+
+    decimationCount = pendingAfter;
+    if (outCount != out.count) {
+        out.count = outCount;
+        out.sample_period_ns = batch.sample_period_ns * static_cast<uint32_t>(factor);
+        out.last_timestamp_ns = batch.last_timestamp_ns - pendingAfter * batch.sample_period_ns;
+    }
+}
+
+void ImuFilter::process(ImuBatch& batch, ImuBatch& decimated) {
+    calibrate(batch);
+    lowPass(batch);
+    complementary(batch);
+    decimate(batch, decimated);
+}
@@ -1,12 +1,63 @@
 #include "sensors/mpu6050/motion_processor.hpp"
+#include "sensors/mpu6050/i2c_imu_fifo.hpp"
+#include "sensors/mpu6050/simulated_imu_fifo.hpp"
+#include "utils/clock.hpp"
+
+namespace {
+
+// ±2 g and ±250 deg/s full scale.
+constexpr float kAccelScale = 9.80665f / 16384.0f;
+constexpr float kGyroScale = 1.0f / 131.0f;
+constexpr const char* kDefaultBus = "/dev/i2c-1";
+
+std::unique_ptr<ImuFifo> openDefaultFifo() {
+    auto device = std::make_unique<I2CImuFifo>(kDefaultBus);
+    if (device->isOpen()) {
+        return device;
+    }
+    return std::make_unique<SimulatedImuFifo>();
+}
+
+} // namespace
+
+MotionProcessor::MotionProcessor() : MotionProcessor(openDefaultFifo()) {}
+
+MotionProcessor::MotionProcessor(std::unique_ptr<ImuFifo> fifo)
+    : fifo(std::move(fifo)),
+      hardware(dynamic_cast<I2CImuFifo*>(this->fifo.get()) != nullptr) {}
 
 MPU6050Data MotionProcessor::readMotionData() {
-    return {
-        (float)(std::rand() % 2000 - 1000) / 100.0f,
-        (float)(std::rand() % 2000 - 1000) / 100.0f,
-        (float)(std::rand() % 2000 - 1000) / 100.0f,
-        (float)(std::rand() % 360),
-        (float)(std::rand() % 360),
-        (float)(std::rand() % 360)
-    };
+    if (readBatch(latest) > 0) {
+        last = latest.sample(latest.count - 1);
+    }
+    return last;
+}
+
+size_t MotionProcessor::readBatch(ImuBatch& batch) {
+    size_t bytes = 0;
+    while (bytes < sizeof(raw)) {
+        size_t n = fifo->read(raw + bytes, sizeof(raw) - bytes);
+        if (n == 0) {
+            break;
+        }
+        bytes += n;
+    }
+
+    size_t count = bytes / kMpu6050SampleBytes;
+    static constexpr float kScales[kImuChannelCount] = {
+        kAccelScale, kAccelScale, kAccelScale, kGyroScale, kGyroScale, kGyroScale};
+    for (size_t c = 0; c < kImuChannelCount; ++c) {
+        const uint8_t* src = raw + 2 * c;
+        float* dst = batch.channels[c];
+        const float scale = kScales[c];
+        for (size_t i = 0; i < count; ++i) {
+            const uint8_t* p = src + i * kMpu6050SampleBytes;
+            dst[i] = static_cast<float>(static_cast<int16_t>((p[0] << 8) | p[1])) * scale;
+        }
+    }
+
+    batch.count = count;
+    batch.sample_period_ns = fifo->samplePeriodNs();
+    batch.last_timestamp_ns = monotonicNs();
+    return count;
 }
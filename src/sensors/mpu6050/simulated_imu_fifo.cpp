@@ -0,0 +1,73 @@
+#include "sensors/mpu6050/simulated_imu_fifo.hpp"
+#include "utils/clock.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr size_t kFifoSamples = kMpu6050FifoBytes / kMpu6050SampleBytes;
+constexpr double kTwoPi = 6.283185307179586;
+
+void putBigEndian(uint8_t* out, double value) {
+    long raw = std::lround(value);
+    raw = std::min(32767L, std::max(-32768L, raw));
+    uint16_t bits = static_cast<uint16_t>(static_cast<int16_t>(raw));
+    out[0] = static_cast<uint8_t>(bits >> 8);
+    out[1] = static_cast<uint8_t>(bits & 0xFF);
+}
+
+} // namespace
+
+SimulatedImuFifo::SimulatedImuFifo(uint32_t sampleRateHz, bool realtime, uint64_t seed)
+    : periodNs(1000000000u / std::max(sampleRateHz, 1u)),
+      realtime(realtime),
+      rngState(seed | 1),
+      startNs(monotonicNs()) {}
+
+void SimulatedImuFifo::push(size_t count) {
+    pending += count;
+    produced += count;
+    if (pending > kFifoSamples) {
+        overflowCount += pending - kFifoSamples;
+        pending = kFifoSamples;
+    }
+}
+
+void SimulatedImuFifo::updatePending() {
+    uint64_t due = (monotonicNs() - startNs) / periodNs;
+    if (due > produced) {
+        push(static_cast<size_t>(due - produced));
+    }
+}
+
+size_t SimulatedImuFifo::read(uint8_t* buffer, size_t capacity) {
+    if (realtime) {
+        updatePending();
+    }
+    size_t samples = std::min(pending, capacity / kMpu6050SampleBytes);
+    for (size_t i = 0; i < samples; ++i) {
+        encodeSample(buffer + i * kMpu6050SampleBytes);
+    }
+    return samples * kMpu6050SampleBytes;
+}
+
+// Slow sway on X/Y around 1 g on Z, a gyro oscillation on X, fixed biases
+// and a little uniform noise, at the ±2 g / ±250 deg/s scales.
+void SimulatedImuFifo::encodeSample(uint8_t* out) {
+    double t = static_cast<double>(produced - pending) * periodNs * 1e-9;
+    --pending;
+
+    auto noise = [this] {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 7;
+        rngState ^= rngState << 17;
+        return static_cast<double>(rngState >> 11) * (1.0 / 9007199254740992.0) - 0.5;
+    };
+
+    double accel[3] = {0.02 + 0.2 * std::sin(kTwoPi * t), 0.2 * std::cos(kTwoPi * t), 1.0};
+    double gyro[3] = {1.0 + 10.0 * std::sin(kTwoPi * 0.5 * t), -0.5, 0.25};
+    for (int axis = 0; axis < 3; ++axis) {
+        putBigEndian(out + 2 * axis, (accel[axis] + 0.01 * noise()) * 16384.0);
+        putBigEndian(out + 6 + 2 * axis, (gyro[axis] + 0.2 * noise()) * 131.0);
+    }
+}
@@ -0,0 +1,141 @@
+#include "sensors/sensor_scheduler.hpp"
+#include "utils/clock.hpp"
+#include "utils/metrics.hpp"
+#include <cerrno>
+#include <map>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+namespace {
+
+void sleepUntil(int64_t deadlineNs) {
+    timespec ts;
+    ts.tv_sec = static_cast<time_t>(deadlineNs / 1000000000);
+    ts.tv_nsec = static_cast<long>(deadlineNs % 1000000000);
+    while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+    }
+}
+
+void pinToCore(int core) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+}
+
+} // namespace
+
+SensorScheduler::~SensorScheduler() {
+    stop();
+}
+
+size_t SensorScheduler::addTask(const SensorTaskConfig& config, std::function<void()> body) {
+    auto task = std::make_unique<Task>();
+    task->config = config;
+    if (task->config.period.count() <= 0) {
+        task->config.period = std::chrono::nanoseconds(1);
+    }
+    task->body = std::move(body);
+    task->runtime = &Metrics::stage("sensor." + task->config.name);
+    task->jitter = &Metrics::stage("sensor." + task->config.name + ".jitter");
+    tasks.push_back(std::move(task));
+    return tasks.size() - 1;
+}
+
+void SensorScheduler::start() {
+    if (running.exchange(true)) {
+        return;
+    }
+
+    std::map<int, Lane*> shared;
+    for (const std::unique_ptr<Task>& task : tasks) {
+        Lane* lane = nullptr;
+        if (task->config.lane >= 0) {
+            auto it = shared.find(task->config.lane);
+            if (it != shared.end()) {
+                lane = it->second;
+            }
+        }
+        if (lane == nullptr) {
+            lanes.push_back(std::make_unique<Lane>());
+            lane = lanes.back().get();
+            if (task->config.lane >= 0) {
+                shared[task->config.lane] = lane;
+            }
+        }
+        if (lane->core < 0) {
+            lane->core = task->config.core;
+        }
+        lane->tasks.push_back(task.get());
+    }
+
+    for (const std::unique_ptr<Lane>& lane : lanes) {
+        Lane* target = lane.get();
+        lane->thread = std::thread([this, target] { runLane(*target); });
+    }
+}
+
+void SensorScheduler::stop() {
+    running.store(false);
+    for (const std::unique_ptr<Lane>& lane : lanes) {
+        if (lane->thread.joinable()) {
+            lane->thread.join();
+        }
+    }
+    lanes.clear();
+}
+
+void SensorScheduler::runLane(Lane& lane) {
+    if (lane.core >= 0) {
+        pinToCore(lane.core);
+    }
+
+    int64_t now = static_cast<int64_t>(monotonicNs());
+    for (Task* task : lane.tasks) {
+        task->nextRelease = now;
+    }
+
+    while (running.load(std::memory_order_relaxed)) {
+        // Earliest release first; ties go to the task registered first.
+        Task* task = lane.tasks.front();
+        for (Task* candidate : lane.tasks) {
+            if (candidate->nextRelease < task->nextRelease) {
+                task = candidate;
+            }
+        }
+
+        sleepUntil(task->nextRelease);
+        if (!running.load(std::memory_order_relaxed)) {
+            break;
+        }
+
+        SensorTaskStats& stats = task->stats;
+        int64_t started = static_cast<int64_t>(monotonicNs());
+        uint64_t jitter = static_cast<uint64_t>(started - task->nextRelease);
+        stats.last_jitter_ns.store(jitter, std::memory_order_relaxed);
+        task->jitter->record(jitter);
+        if (jitter > stats.max_jitter_ns.load(std::memory_order_relaxed)) {
+            stats.max_jitter_ns.store(jitter, std::memory_order_relaxed);
+        }
+        if (jitter > static_cast<uint64_t>(task->config.jitter_budget.count())) {
+            stats.jitter_violations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        task->body();
+
+        int64_t finished = static_cast<int64_t>(monotonicNs());
+        int64_t period = task->config.period.count();
+        uint64_t runtime = static_cast<uint64_t>(finished - started);
+        stats.last_runtime_ns.store(runtime, std::memory_order_relaxed);
+        task->runtime->record(runtime);
+        stats.runs.fetch_add(1, std::memory_order_relaxed);
+
+        task->nextRelease += period;
+        if (finished > task->nextRelease) {
+            int64_t missed = (finished - task->nextRelease) / period;
+            stats.overruns.fetch_add(1 + static_cast<uint64_t>(missed), std::memory_order_relaxed);
+            task->nextRelease += missed * period;
+        }
+    }
+}
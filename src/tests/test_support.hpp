@@ -0,0 +1,87 @@
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// Minimal self-contained checks: every test binary runs its cases from
+// main() and returns testResult(), so ctest needs no framework.
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition)                                                               \
+    do {                                                                               \
+        if (!(condition)) {                                                            \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            ++testFailures();                                                          \
+        }                                                                              \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance)                                        \
+    do {                                                                               \
+        double checkActual = (actual);                                                 \
+        double checkExpected = (expected);                                             \
+        if (!(std::fabs(checkActual - checkExpected) <= (tolerance))) {                \
+            std::fprintf(stderr, "%s:%d: CHECK_NEAR(%s, %s) failed: %g vs %g\n", __FILE__, __LINE__, \
+                         #actual, #expected, checkActual, checkExpected);             \
+            ++testFailures();                                                          \
+        }                                                                              \
+    } while (0)
+
+#define RUN_TEST(test)                                    \
+    do {                                                  \
+        int failuresBefore = testFailures();              \
+        test();                                           \
+        std::printf("%s %s\n", testFailures() == failuresBefore ? "PASS" : "FAIL", #test); \
+    } while (0)
+
+inline int testResult() {
+    return testFailures() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// A scratch directory standing in for /proc, /sys or a cgroup; removed
+// again when the TempTree goes out of scope.
+class TempTree {
+public:
+    TempTree() {
+        std::string pattern = (std::filesystem::temp_directory_path() / "era_test_XXXXXX").string();
+        if (::mkdtemp(pattern.data()) != nullptr) {
+            rootPath = pattern;
+        }
+    }
+
+    ~TempTree() {
+        std::error_code ec;
+        std::filesystem::remove_all(rootPath, ec);
+    }
+
+    TempTree(const TempTree&) = delete;
+    TempTree& operator=(const TempTree&) = delete;
+
+    const std::string& root() const { return rootPath; }
+    std::string path(const std::string& relative) const { return rootPath + "/" + relative; }
+
+    // Creates parent directories; replaces any previous contents.
+    void write(const std::string& relative, const std::string& contents) const {
+        std::filesystem::path file = path(relative);
+        std::filesystem::create_directories(file.parent_path());
+        std::ofstream(file, std::ios::trunc) << contents;
+    }
+
+    void mkdir(const std::string& relative) const {
+        std::filesystem::create_directories(path(relative));
+    }
+
+    std::string read(const std::string& relative) const {
+        std::ifstream file(path(relative));
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+private:
+    std::string rootPath;
+};
@@ -0,0 +1,279 @@
+#include "resource/actuator_gate.hpp"
+#include "resource/cpu/cpu_optimizer.hpp"
+#include "resource/memory/memory_optimizer.hpp"
+#include "resource/power/power_optimizer.hpp"
+#include "utils/sysfs_writer.hpp"
+#include "../test_support.hpp"
+
+namespace {
+
+constexpr uint64_t kMs = 1000000;
+const ActuatorLimits kNoLimits{0.0, std::chrono::milliseconds(0)};
+const std::string kPolicy = "devices/system/cpu/cpufreq/policy0";
+
+void writeCpuTree(const TempTree& sys, int cores) {
+    for (int cpu = 0; cpu < cores; ++cpu) {
+        sys.mkdir("devices/system/cpu/cpu" + std::to_string(cpu));
+    }
+    sys.mkdir("devices/system/cpu/cpufreq");   // not a core
+}
+
+void writePolicy(const TempTree& sys, const std::string& governors, const std::string& frequencies) {
+    sys.write(kPolicy + "/cpuinfo_max_freq", "1800000\n");
+    sys.write(kPolicy + "/cpuinfo_min_freq", "600000\n");
+    sys.write(kPolicy + "/scaling_min_freq", "600000\n");
+    sys.write(kPolicy + "/scaling_max_freq", "1800000\n");
+    sys.write(kPolicy + "/scaling_governor", "ondemand\n");
+    sys.write(kPolicy + "/scaling_available_governors", governors);
+    if (!frequencies.empty()) {
+        sys.write(kPolicy + "/scaling_available_frequencies", frequencies);
+    }
+}
+
+void testWriterSkipsUnchangedValues() {
+    TempTree cgroup;
+    cgroup.write("cpu.max", "max 100000\n");
+    SysfsWriter writer;
+    int cpuMax = writer.attach(cgroup.path("cpu.max"));
+    CHECK(cpuMax >= 0);
+    CHECK(std::string(writer.current(cpuMax)) == "max 100000");
+
+    // Same as the file already holds: nothing is written.
+    writer.stage(cpuMax, "max 100000");
+    CHECK(writer.commit() == 0);
+    CHECK(writer.writeCount() == 0);
+    CHECK(writer.skippedCount() == 1);
+
+    writer.stage(cpuMax, "50000 100000");
+    writer.commit();
+    CHECK(writer.writeCount() == 1);
+    CHECK(cgroup.read("cpu.max") == "50000 100000");
+
+    writer.stage(cpuMax, "50000 100000");
+    writer.commit();
+    CHECK(writer.writeCount() == 1);
+    CHECK(writer.skippedCount() == 2);
+
+    // Nothing staged: commit is a no-op.
+    writer.commit();
+    CHECK(writer.writeCount() == 1);
+    CHECK(writer.skippedCount() == 2);
+}
+
+void testWriterMissingAttribute() {
+    TempTree cgroup;
+    SysfsWriter writer;
+    int missing = writer.attach(cgroup.path("memory.high"));
+    CHECK(missing == -1);
+    writer.stage(missing, uint64_t(4096));
+    CHECK(writer.commit() == 0);
+    CHECK(writer.attributeCount() == 0);
+}
+
+void testGateHysteresisAndInterval() {
+    ActuatorGate gate({2.0, std::chrono::milliseconds(100)});
+    CHECK(gate.admit(50.0, 1 * kMs));          // first target always passes
+    CHECK(gate.hasApplied());
+    CHECK(!gate.admit(51.5, 500 * kMs));       // within hysteresis
+    CHECK(!gate.admit(60.0, 50 * kMs));        // too soon after the change
+    CHECK(gate.admit(60.0, 101 * kMs));
+    CHECK(gate.applied() == 60.0);
+    CHECK(!gate.admit(58.5, 1000 * kMs));      // hysteresis applies both ways
+    CHECK(gate.admit(58.0, 1000 * kMs));
+    CHECK(gate.suppressed() == 3);
+}
+
+void testGateRisesAtOnceAndFallsGradually() {
+    ActuatorGate gate({2.0, std::chrono::milliseconds(100), true, 10.0});
+    CHECK(gate.admit(50.0, 1 * kMs));
+    CHECK(gate.admit(51.0, 2 * kMs));          // rises skip hysteresis and interval
+    CHECK(gate.applied() == 51.0);
+    CHECK(!gate.admit(20.0, 50 * kMs));        // falls still wait for the interval
+    CHECK(gate.admit(20.0, 150 * kMs));
+    CHECK(gate.applied() == 41.0);             // at most 10 points per change
+    CHECK(gate.admit(20.0, 300 * kMs));
+    CHECK(gate.applied() == 31.0);
+    CHECK(!gate.admit(30.0, 500 * kMs));       // hysteresis still applies going down
+}
+
+void testCpuCapFollowsDemandUp() {
+    TempTree sys;
+    TempTree cgroup;
+    writeCpuTree(sys, 4);
+    cgroup.write("cpu.max", "max 100000\n");
+    cgroup.write("cpuset.cpus", "0-3\n");
+    CPUOptimizer optimizer(cgroup.root(), sys.root());   // default limits
+
+    optimizer.optimize(50.0);
+    CHECK(cgroup.read("cpu.max") == "200000 100000");
+    optimizer.optimize(20.0);   // within the 5 s interval: held
+    CHECK(cgroup.read("cpu.max") == "200000 100000");
+    optimizer.optimize(80.0);   // demand rose: applied at once
+    CHECK(cgroup.read("cpu.max") == "320000 100000");
+    CHECK(cgroup.read("cpuset.cpus") == "0-3");
+}
+
+void testCpuSingleCore() {
+    TempTree sys;
+    TempTree cgroup;
+    writeCpuTree(sys, 4);
+    cgroup.write("cpu.max", "max 100000\n");
+    cgroup.write("cpuset.cpus", "0-3\n");
+    CPUOptimizer optimizer(cgroup.root(), sys.root(), kNoLimits);
+    CHECK(optimizer.coreCount() == 4);
+
+    optimizer.optimize(10.0);   // 0.4 of one core, the last one
+    CHECK(cgroup.read("cpuset.cpus") == "3");
+    CHECK(cgroup.read("cpu.max") == "40000 100000");
+
+    optimizer.optimize(0.01);   // quota never drops below 1 ms per period
+    CHECK(cgroup.read("cpu.max") == "1000 100000");
+}
+
+void testCpuSeveralCores() {
+    TempTree sys;
+    TempTree cgroup;
+    writeCpuTree(sys, 4);
+    cgroup.write("cpu.max", "max 100000\n");
+    cgroup.write("cpuset.cpus", "0-3\n");
+    CPUOptimizer optimizer(cgroup.root(), sys.root(), kNoLimits);
+
+    optimizer.optimize(60.0);   // 2.4 cores, keeping cpu0 free
+    CHECK(cgroup.read("cpuset.cpus") == "1-3");
+    CHECK(cgroup.read("cpu.max") == "240000 100000");
+}
+
+void testCpuFullMachine() {
+    TempTree sys;
+    TempTree cgroup;
+    writeCpuTree(sys, 4);
+    cgroup.write("cpu.max", "max 100000\n");
+    cgroup.write("cpuset.cpus", "0-3\n");
+    CPUOptimizer optimizer(cgroup.root(), sys.root(), kNoLimits);
+
+    optimizer.optimize(100.0);
+    CHECK(cgroup.read("cpuset.cpus") == "0-3\n");     // untouched
+    CHECK(cgroup.read("cpu.max") == "max 100000\n");
+    CHECK(optimizer.getWriter().writeCount() == 0);
+    CHECK(optimizer.getWriter().skippedCount() == 2);
+
+    optimizer.optimize(150.0);  // clamped to 100
+    CHECK(optimizer.getWriter().writeCount() == 0);
+}
+
+void testMemoryHighPageRounding() {
+    TempTree proc;
+    TempTree cgroup;
+    proc.write("meminfo", "MemTotal:           1000 kB\nMemFree:             10 kB\n");
+    cgroup.write("memory.high", "max\n");
+    MemoryOptimizer optimizer(cgroup.root(), proc.root(), kNoLimits);
+    CHECK(optimizer.totalBytes() == 1024000);
+
+    optimizer.optimize(33.0);   // 337920 bytes, rounded down to 82 pages
+    CHECK(cgroup.read("memory.high") == "335872");
+
+    optimizer.optimize(0.1);    // never below one page
+    CHECK(cgroup.read("memory.high") == "4096");
+
+    optimizer.optimize(100.0);
+    CHECK(cgroup.read("memory.high") == "max");
+}
+
+void testMemoryWithoutMeminfo() {
+    TempTree proc;
+    TempTree cgroup;
+    cgroup.write("memory.high", "max\n");
+    MemoryOptimizer optimizer(cgroup.root(), proc.root(), kNoLimits);
+    optimizer.optimize(50.0);
+    CHECK(cgroup.read("memory.high") == "max\n");
+}
+
+PowerOptimizerConfig enabledPower(double maxWatts) {
+    PowerOptimizerConfig config;
+    config.enabled = true;
+    config.max_power_watts = maxWatts;
+    return config;
+}
+
+void testPowerSnapsToAvailableFrequency() {
+    TempTree sys;
+    writePolicy(sys, "conservative ondemand userspace powersave performance schedutil\n",
+                "600000 1000000 1400000 1800000\n");
+    PowerOptimizer optimizer(sys.root(), enabledPower(6.0), kNoLimits);
+    CHECK(optimizer.policyCount() == 1);
+
+    optimizer.optimize(3.0);    // 1200000 kHz target, highest step within it
+    CHECK(sys.read(kPolicy + "/scaling_max_freq") == "1000000");
+    CHECK(sys.read(kPolicy + "/scaling_governor") == "schedutil");
+
+    optimizer.optimize(1.0);    // below the lowest step: the lowest step
+    CHECK(sys.read(kPolicy + "/scaling_max_freq") == "600000");
+    CHECK(sys.read(kPolicy + "/scaling_governor") == "conservative");
+
+    optimizer.optimize(12.0);   // over budget: full range
+    CHECK(sys.read(kPolicy + "/scaling_max_freq") == "1800000");
+}
+
+void testPowerWithoutFrequencyTable() {
+    TempTree sys;
+    writePolicy(sys, "schedutil\n", "");
+    PowerOptimizer optimizer(sys.root(), enabledPower(6.0), kNoLimits);
+    optimizer.optimize(3.0);
+    CHECK(sys.read(kPolicy + "/scaling_max_freq") == "1200000");
+}
+
+void testPowerGovernorFallback() {
+    TempTree sys;
+    writePolicy(sys, "ondemand performance\n", "");
+    PowerOptimizer optimizer(sys.root(), enabledPower(6.0), kNoLimits);
+    optimizer.optimize(1.0);    // conservative not offered
+    CHECK(sys.read(kPolicy + "/scaling_governor") == "ondemand\n");   // already set, skipped
+
+    TempTree bare;
+    writePolicy(bare, "performance\n", "");
+    PowerOptimizer fixed(bare.root(), enabledPower(6.0), kNoLimits);
+    fixed.optimize(4.0);        // neither preferred nor fallback offered
+    CHECK(bare.read(kPolicy + "/scaling_governor") == "ondemand\n");
+    CHECK(bare.read(kPolicy + "/scaling_max_freq") == "1400000");
+}
+
+void testPowerOptInAndBudget() {
+    TempTree sys;
+    writePolicy(sys, "schedutil\n", "");
+
+    PowerOptimizer disabled(sys.root(), PowerOptimizerConfig(), kNoLimits);
+    disabled.optimize(1.0);
+    CHECK(sys.read(kPolicy + "/scaling_max_freq") == "1800000\n");
+
+    // Enabled but no budget configured: nothing until a draw is observed.
+    PowerOptimizer calibrated(sys.root(), enabledPower(0.0), kNoLimits);
+    calibrated.optimize(1.0);
+    CHECK(sys.read(kPolicy + "/scaling_max_freq") == "1800000\n");
+    CHECK(!calibrated.getGate().hasApplied());
+
+    calibrated.observePower(4.0);
+    calibrated.observePower(2.0);
+    CHECK(calibrated.fullPowerWatts() == 4.0);
+    calibrated.optimize(2.0);   // half of the peak draw
+    CHECK(sys.read(kPolicy + "/scaling_max_freq") == "1200000");
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testWriterSkipsUnchangedValues);
+    RUN_TEST(testWriterMissingAttribute);
+    RUN_TEST(testGateHysteresisAndInterval);
+    RUN_TEST(testGateRisesAtOnceAndFallsGradually);
+    RUN_TEST(testCpuCapFollowsDemandUp);
+    RUN_TEST(testCpuSingleCore);
+    RUN_TEST(testCpuSeveralCores);
+    RUN_TEST(testCpuFullMachine);
+    RUN_TEST(testMemoryHighPageRounding);
+    RUN_TEST(testMemoryWithoutMeminfo);
+    RUN_TEST(testPowerSnapsToAvailableFrequency);
+    RUN_TEST(testPowerWithoutFrequencyTable);
+    RUN_TEST(testPowerGovernorFallback);
+    RUN_TEST(testPowerOptInAndBudget);
+    return testResult();
+}
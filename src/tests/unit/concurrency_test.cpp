@@ -0,0 +1,216 @@
+#include "sensors/camera/camera_capture.hpp"
+#include "sensors/camera/frame_pool.hpp"
+#include "sensors/sensor_scheduler.hpp"
+#include "utils/telemetry_channel.hpp"
+#include "../test_support.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Several words, so a torn read would mix two publishes.
+struct StressPayload {
+    uint64_t words[7];
+    uint64_t checksum;
+};
+
+uint64_t checksumOf(const StressPayload& payload) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (uint64_t word : payload.words) {
+        hash = (hash ^ word) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+class CountingRecycler : public FrameRecycler {
+public:
+    void recycle(uint32_t index) override {
+        ++recycled;
+        last = index;
+    }
+
+    int recycled = 0;
+    uint32_t last = 0;
+};
+
+void testChannelHistoryOrder() {
+    TelemetryChannel<int, 8> channel;
+    int value = -1;
+    CHECK(!channel.latest(value));
+
+    for (int i = 0; i < 10; ++i) {
+        channel.publish(i, 1000 + i);
+    }
+    CHECK(channel.latest(value) && value == 9);
+
+    TelemetryChannel<int, 8>::Sample samples[16];
+    size_t count = channel.history(samples, 16);
+    CHECK(count == 8);
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(samples[i].sequence == i + 2);
+        CHECK(samples[i].value == static_cast<int>(i + 2));
+        CHECK(samples[i].timestamp_ns == 1002 + i);
+    }
+    CHECK(channel.history(samples, 3) == 3 && samples[0].value == 7);
+}
+
+// One writer overwrites a small ring as fast as it can while readers copy
+// it. Every sample a reader gets must be whole: the checksum matches and the
+// payload belongs to the sequence number it was returned with.
+void testChannelSeqlockStress() {
+    constexpr uint64_t kPublishes = 200000;
+    constexpr int kReaders = 3;
+    using Channel = TelemetryChannel<StressPayload, 4>;
+    Channel channel;
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> reads{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < kReaders; ++r) {
+        readers.emplace_back([&] {
+            Channel::Sample samples[Channel::capacity()];
+            uint64_t lastSequence = 0;
+            uint64_t local = 0;
+            uint64_t bad = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                Channel::Sample sample;
+                if (channel.latest(sample)) {
+                    if (sample.value.checksum != checksumOf(sample.value) ||
+                        sample.value.words[0] != sample.sequence || sample.sequence < lastSequence) {
+                        ++bad;
+                    }
+                    lastSequence = sample.sequence;
+                    ++local;
+                }
+                size_t count = channel.history(samples, Channel::capacity());
+                for (size_t i = 0; i < count; ++i) {
+                    if (samples[i].value.checksum != checksumOf(samples[i].value) ||
+                        samples[i].value.words[0] != samples[i].sequence ||
+                        (i > 0 && samples[i].sequence != samples[i - 1].sequence + 1)) {
+                        ++bad;
+                    }
+                }
+                local += count;
+            }
+            torn.fetch_add(bad);
+            reads.fetch_add(local);
+        });
+    }
+
+    for (uint64_t n = 0; n < kPublishes; ++n) {
+        StressPayload payload;
+        for (uint64_t i = 0; i < 7; ++i) {
+            payload.words[i] = n * (i + 1);
+        }
+        payload.checksum = checksumOf(payload);
+        channel.publish(payload);
+    }
+    done.store(true, std::memory_order_release);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    CHECK(torn.load() == 0);
+    CHECK(reads.load() > 0);
+    CHECK(channel.publishedCount() == kPublishes);
+    Channel::Sample last;
+    CHECK(channel.latest(last) && last.sequence == kPublishes - 1 &&
+          last.value.checksum == checksumOf(last.value));
+}
+
+void testFramePoolExhaustionAndReuse() {
+    CountingRecycler recycler;
+    FramePool pool(&recycler);
+    pool.allocate(2, 100);
+    CHECK(pool.size() == 2 && pool.bufferBytes() == 100);
+
+    int32_t first = pool.tryAcquire();
+    int32_t second = pool.tryAcquire();
+    CHECK(first >= 0 && second >= 0 && first != second);
+    CHECK(pool.tryAcquire() == -1);
+
+    // Abandoning a claimed slot frees it without publishing.
+    pool.abandon(static_cast<uint32_t>(second));
+    CHECK(recycler.recycled == 1);
+    CHECK(pool.tryAcquire() == second);
+    pool.abandon(static_cast<uint32_t>(second));
+
+    CameraFrame info;
+    info.size = 100;
+    info.sequence = 7;
+    FrameView view = pool.publish(static_cast<uint32_t>(first), info);
+    CHECK(view && view.info().sequence == 7 && view.data() == pool.buffer(first));
+    {
+        FrameView copy = view;
+        FrameView moved = std::move(view);
+        CHECK(!view && moved && copy.data() == moved.data());
+        CHECK(pool.tryAcquire() == second);
+        CHECK(pool.tryAcquire() == -1);   // one slot published, one claimed
+        pool.abandon(static_cast<uint32_t>(second));
+        CHECK(recycler.recycled == 3);
+    }
+    // The last view is gone, so the published slot is free again.
+    CHECK(recycler.recycled == 4 && recycler.last == static_cast<uint32_t>(first));
+    CHECK(pool.tryAcquire() == first);
+}
+
+void testCaptureDropsWhenPoolExhausted() {
+    CameraConfig config;
+    config.backend = CameraBackend::Synthetic;
+    config.width = 16;
+    config.height = 8;
+    config.buffer_count = 2;
+    CameraCapture capture(config);
+    CHECK(capture.isOpen());
+
+    FrameView first = capture.acquireFrame();
+    FrameView second = capture.acquireFrame();
+    CHECK(first && second && first.data() != second.data());
+    CHECK(!capture.acquireFrame());
+    CHECK(capture.getStats().delivered == 2 && capture.getStats().dropped == 1);
+
+    const uint8_t* freed = first.data();
+    first = FrameView();
+    FrameView third = capture.acquireFrame();
+    CHECK(third && third.data() == freed);
+    CHECK(third.info().sequence == 3);   // the dropped frame used sequence 2
+    CHECK(capture.getStats().delivered == 3 && capture.getStats().dropped == 1);
+}
+
+// A task that always runs 2.5 periods is charged the late finish plus each
+// skipped release; a quick task on its own lane is not held up by it.
+void testSchedulerOverruns() {
+    using namespace std::chrono_literals;
+    SensorScheduler scheduler;
+    size_t slow = scheduler.addTask({"test.slow", 10ms, 1ms}, [] { std::this_thread::sleep_for(25ms); });
+    size_t quick = scheduler.addTask({"test.quick", 10ms, 5ms}, [] {});
+
+    scheduler.start();
+    std::this_thread::sleep_for(300ms);
+    scheduler.stop();
+
+    const SensorTaskStats& slowStats = scheduler.getStats(slow);
+    uint64_t slowRuns = slowStats.runs.load();
+    CHECK(slowRuns >= 3);
+    CHECK(slowRuns <= 300 / 25 + 1);   // skipped releases are not made up
+    CHECK(slowStats.overruns.load() >= 2 * slowRuns - 1);
+    CHECK(slowStats.last_runtime_ns.load() >= 25000000);
+
+    const SensorTaskStats& quickStats = scheduler.getStats(quick);
+    CHECK(quickStats.runs.load() >= 15);
+    CHECK(quickStats.overruns.load() < quickStats.runs.load() / 4);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testChannelHistoryOrder);
+    RUN_TEST(testChannelSeqlockStress);
+    RUN_TEST(testFramePoolExhaustionAndReuse);
+    RUN_TEST(testCaptureDropsWhenPoolExhausted);
+    RUN_TEST(testSchedulerOverruns);
+    return testResult();
+}
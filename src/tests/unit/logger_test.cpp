@@ -0,0 +1,215 @@
+#include "utils/log_record.hpp"
+#include "utils/logger.hpp"
+#include "utils/mpsc_ring.hpp"
+#include "../test_support.hpp"
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t kProducers = 4;
+
+struct DecodedRecord {
+    LogRecordHeader header;
+    std::string payload;
+};
+
+// Reads a log file the way log_decode does. Returns false if the file
+// header is wrong or the file ends inside a record.
+bool decodeLog(const std::string& contents, std::vector<DecodedRecord>& records) {
+    LogFileHeader fileHeader;
+    if (contents.size() < sizeof(fileHeader)) {
+        return false;
+    }
+    std::memcpy(&fileHeader, contents.data(), sizeof(fileHeader));
+    if (std::memcmp(fileHeader.magic, kLogFileMagic, sizeof(fileHeader.magic)) != 0 ||
+        fileHeader.version != kLogFormatVersion ||
+        fileHeader.record_header_size != sizeof(LogRecordHeader)) {
+        return false;
+    }
+
+    size_t offset = sizeof(fileHeader);
+    while (offset < contents.size()) {
+        DecodedRecord record;
+        if (contents.size() - offset < sizeof(record.header)) {
+            return false;
+        }
+        std::memcpy(&record.header, contents.data() + offset, sizeof(record.header));
+        offset += sizeof(record.header);
+        if (contents.size() - offset < record.header.length) {
+            return false;
+        }
+        record.payload.assign(contents.data() + offset, record.header.length);
+        offset += record.header.length;
+        records.push_back(std::move(record));
+    }
+    return true;
+}
+
+void testRingFullAndEmpty() {
+    MpscRing<int, 4> ring;
+    CHECK(ring.peek(0) == nullptr);
+    for (int i = 0; i < 4; ++i) {
+        CHECK(ring.tryPush([&](int& value) { value = i; }));
+    }
+    bool called = false;
+    CHECK(!ring.tryPush([&](int&) { called = true; }));
+    CHECK(!called);
+
+    CHECK(ring.peek(3) != nullptr && *ring.peek(3) == 3);
+    ring.release(2);
+    CHECK(*ring.peek(0) == 2);
+    CHECK(ring.tryPush([](int& value) { value = 4; }));
+    CHECK(ring.tryPush([](int& value) { value = 5; }));
+    CHECK(*ring.peek(3) == 5);
+    CHECK(ring.peek(4) == nullptr);
+}
+
+// Producers retry until every value is in; the consumer must see each one
+// exactly once and in per-producer order.
+void testRingMultipleProducers() {
+    constexpr uint64_t kPerProducer = 50000;
+    MpscRing<uint64_t, 64> ring;
+
+    std::vector<std::thread> producers;
+    for (uint64_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, p] {
+            for (uint64_t i = 0; i < kPerProducer; ++i) {
+                while (!ring.tryPush([&](uint64_t& value) { value = (p << 32) | i; })) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<uint64_t> next(kProducers, 0);
+    uint64_t received = 0;
+    bool ordered = true;
+    while (received < kProducers * kPerProducer) {
+        size_t taken = 0;
+        while (const uint64_t* value = ring.peek(taken)) {
+            uint64_t producer = *value >> 32;
+            uint64_t sequence = *value & 0xFFFFFFFFu;
+            if (producer >= kProducers || sequence != next[producer]) {
+                ordered = false;
+            } else {
+                ++next[producer];
+            }
+            ++taken;
+        }
+        ring.release(taken);
+        received += taken;
+        if (taken == 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    CHECK(ordered);
+    for (uint64_t count : next) {
+        CHECK(count == kPerProducer);
+    }
+    CHECK(ring.peek(0) == nullptr);
+}
+
+void testRoundTrip() {
+    TempTree tree;
+    LogSinkId sink = Logger::openSink(tree.path("logs/round_trip.log"));
+    CHECK(sink != kInvalidLogSink);
+    CHECK(Logger::openSink(tree.path("logs/round_trip.log")) == sink);
+
+    std::string oversize(kLogPayloadCapacity + 100, 'x');
+    oversize.replace(0, 5, "start");
+    CHECK(Logger::log(sink, "first"));
+    CHECK(Logger::log(sink, std::string()));
+    CHECK(Logger::log(sink, oversize));
+    CHECK(Logger::log(sink, "last\n"));
+    Logger::flush();
+
+    std::vector<DecodedRecord> records;
+    CHECK(decodeLog(tree.read("logs/round_trip.log"), records));
+    CHECK(records.size() == 4);
+    if (records.size() != 4) {
+        return;
+    }
+    CHECK(records[0].payload == "first" && records[0].header.flags == 0);
+    CHECK(records[1].payload.empty() && records[1].header.flags == 0);
+    CHECK(records[2].header.length == kLogPayloadCapacity);
+    CHECK(records[2].payload == oversize.substr(0, kLogPayloadCapacity));
+    CHECK(records[2].header.flags & kLogRecordTruncated);
+    CHECK(records[3].payload == "last\n" && records[3].header.flags == 0);
+    CHECK(records[0].header.timestamp_ns <= records[3].header.timestamp_ns);
+    CHECK(records[0].header.thread_id != 0);
+}
+
+// Producers retry dropped records (the ring is smaller than the burst), so
+// every record must reach the file once, in per-thread order.
+void testConcurrentProducers() {
+    constexpr unsigned kPerProducer = 2000;
+    TempTree tree;
+    LogSinkId sink = Logger::openSink(tree.path("concurrent.log"));
+    CHECK(sink != kInvalidLogSink);
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([sink, p] {
+            for (unsigned i = 0; i < kPerProducer; ++i) {
+                std::string message = std::to_string(p) + ":" + std::to_string(i);
+                while (!Logger::log(sink, message)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    Logger::flush();
+
+    std::vector<DecodedRecord> records;
+    CHECK(decodeLog(tree.read("concurrent.log"), records));
+    std::vector<unsigned> seen(kProducers, 0);
+    std::vector<long> last(kProducers, -1);
+    bool ordered = true;
+    for (const DecodedRecord& record : records) {
+        size_t colon = record.payload.find(':');
+        size_t producer = std::stoul(record.payload.substr(0, colon));
+        long sequence = std::stol(record.payload.substr(colon + 1));
+        if (producer >= kProducers || sequence <= last[producer]) {
+            ordered = false;
+            continue;
+        }
+        last[producer] = sequence;
+        ++seen[producer];
+    }
+    CHECK(ordered);
+    for (unsigned count : seen) {
+        CHECK(count == kPerProducer);
+    }
+}
+
+void testRejectsForeignFile() {
+    TempTree tree;
+    tree.write("plain.log", "not a binary log\n");
+    tree.write("short.log", "ERA");
+    CHECK(Logger::openSink(tree.path("plain.log")) == kInvalidLogSink);
+    CHECK(Logger::openSink(tree.path("short.log")) == kInvalidLogSink);
+    CHECK(tree.read("plain.log") == "not a binary log\n");
+    CHECK(tree.read("short.log") == "ERA");
+    CHECK(!Logger::log(kInvalidLogSink, "dropped"));
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testRingFullAndEmpty);
+    RUN_TEST(testRingMultipleProducers);
+    RUN_TEST(testRoundTrip);
+    RUN_TEST(testConcurrentProducers);
+    RUN_TEST(testRejectsForeignFile);
+    return testResult();
+}
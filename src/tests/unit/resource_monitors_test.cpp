@@ -0,0 +1,169 @@
+#include "resource/cpu/cpu_monitor.hpp"
+#include "resource/memory/memory_monitor.hpp"
+#include "resource/power/power_monitor.hpp"
+#include "resource/pressure_reader.hpp"
+#include "utils/clock.hpp"
+#include "../test_support.hpp"
+#include <chrono>
+#include <thread>
+
+namespace {
+
+constexpr auto kInterval = std::chrono::milliseconds(50);
+
+void testCpuJiffyDeltas() {
+    TempTree proc;
+    proc.write("stat",
+               "cpu  100 0 100 700 100 0 0 0 0 0\n"
+               "cpu0 50 0 50 350 50 0 0 0 0 0\n"
+               "cpu1 50 0 50 350 50 0 0 0 0 0\n"
+               "intr 12345 0 0\n"
+               "ctxt 678\n");
+    CPUMonitor monitor(proc.root());
+    CHECK(monitor.coreCount() == 2);
+    CHECK(!monitor.hasSample());
+
+    // Counters that have not advanced yet are not a sample.
+    CHECK_NEAR(monitor.getCurrentUsage(), 0.0, 1e-9);
+    CHECK(!monitor.hasSample());
+
+    // +400 jiffies overall, 200 of them busy: cpu0 150/200, cpu1 50/200.
+    // iowait (5th field) counts as idle.
+    proc.write("stat",
+               "cpu  225 0 175 850 150 0 0 0 0 0\n"
+               "cpu0 150 0 100 400 50 0 0 0 0 0\n"
+               "cpu1 75 0 75 450 100 0 0 0 0 0\n"
+               "intr 12399 0 0\n"
+               "ctxt 700\n");
+    CHECK_NEAR(monitor.getCurrentUsage(), 50.0, 1e-9);
+    CHECK(monitor.hasSample());
+    CHECK_NEAR(monitor.getCoreUsage(0), 75.0, 1e-9);
+    CHECK_NEAR(monitor.getCoreUsage(1), 25.0, 1e-9);
+
+    // No progress since the last sample reads as idle, not as a division by zero.
+    CHECK_NEAR(monitor.getCurrentUsage(), 0.0, 1e-9);
+}
+
+void testPressureStallPercent() {
+    TempTree proc;
+    proc.write("pressure/cpu",
+               "some avg10=1.50 avg60=0.75 avg300=0.25 total=1000000\n"
+               "full avg10=0.50 avg60=0.00 avg300=0.00 total=500000\n");
+
+    uint64_t beforeFirst = monotonicNs();
+    PressureReader reader(proc.path("pressure/cpu"));
+    uint64_t afterFirst = monotonicNs();
+    CHECK(reader.available());
+
+    std::this_thread::sleep_for(kInterval);
+    // 20 ms of "some" and 10 ms of "full" stall since the first sample.
+    proc.write("pressure/cpu",
+               "some avg10=2.50 avg60=0.75 avg300=0.25 total=1020000\n"
+               "full avg10=1.25 avg60=0.00 avg300=0.00 total=510000\n");
+    PressureStats stats;
+    uint64_t beforeSecond = monotonicNs();
+    CHECK(reader.sample(stats));
+    uint64_t afterSecond = monotonicNs();
+
+    double shortestUs = static_cast<double>(beforeSecond - afterFirst) / 1000.0;
+    double longestUs = static_cast<double>(afterSecond - beforeFirst) / 1000.0;
+    CHECK(stats.some_stall_pct <= 20000.0 * 100.0 / shortestUs);
+    CHECK(stats.some_stall_pct >= 20000.0 * 100.0 / longestUs);
+    CHECK(stats.full_stall_pct <= 10000.0 * 100.0 / shortestUs);
+    CHECK(stats.full_stall_pct >= 10000.0 * 100.0 / longestUs);
+    CHECK_NEAR(stats.some_avg10, 2.5, 1e-9);
+    CHECK_NEAR(stats.full_avg10, 1.25, 1e-9);
+}
+
+void testCpuPressureThroughMonitor() {
+    TempTree proc;
+    proc.write("stat", "cpu  1 0 1 1 0 0 0 0\ncpu0 1 0 1 1 0 0 0 0\n");
+    proc.write("pressure/cpu", "some avg10=3.00 avg60=0.00 avg300=0.00 total=10\n");
+    CPUMonitor monitor(proc.root());
+    monitor.getCurrentUsage();
+    CHECK_NEAR(monitor.getPressure().some_avg10, 3.0, 1e-9);
+}
+
+void testMemoryAvailableUsage() {
+    TempTree proc;
+    proc.write("meminfo",
+               "MemTotal:        1000000 kB\n"
+               "MemFree:          100000 kB\n"
+               "MemAvailable:     250000 kB\n"
+               "Buffers:           10000 kB\n"
+               "SwapTotal:        200000 kB\n"
+               "SwapFree:         150000 kB\n");
+    MemoryMonitor monitor(proc.root());
+    CHECK_NEAR(monitor.getCurrentUsage(), 75.0, 1e-9);
+    CHECK(monitor.getStats().total_kb == 1000000);
+    CHECK(monitor.getStats().available_kb == 250000);
+    CHECK(monitor.getStats().swap_total_kb == 200000);
+    CHECK(monitor.getStats().swap_free_kb == 150000);
+
+    // Usage is based on MemAvailable, not MemFree.
+    proc.write("meminfo",
+               "MemTotal:        1000000 kB\n"
+               "MemFree:          100000 kB\n"
+               "MemAvailable:     900000 kB\n");
+    CHECK_NEAR(monitor.getCurrentUsage(), 10.0, 1e-9);
+}
+
+void testHwmonEnergyToWatts() {
+    TempTree sys;
+    sys.write("class/hwmon/hwmon0/energy1_input", "1000000\n");   // µJ
+
+    uint64_t beforeFirst = monotonicNs();
+    PowerMonitor monitor(sys.root());
+    uint64_t afterFirst = monotonicNs();
+    CHECK(monitor.sourceCount() == 1);
+
+    std::this_thread::sleep_for(kInterval);
+    sys.write("class/hwmon/hwmon0/energy1_input", "1100000\n");   // +0.1 J
+    uint64_t beforeSecond = monotonicNs();
+    double watts = monitor.getCurrentUsage();
+    uint64_t afterSecond = monotonicNs();
+
+    double shortestS = static_cast<double>(beforeSecond - afterFirst) / 1e9;
+    double longestS = static_cast<double>(afterSecond - beforeFirst) / 1e9;
+    CHECK(watts <= 0.1 / shortestS);
+    CHECK(watts >= 0.1 / longestS);
+}
+
+void testHwmonPowerInput() {
+    TempTree sys;
+    sys.write("class/hwmon/hwmon0/power1_input", "2500000\n");    // µW
+    PowerMonitor monitor(sys.root());
+    CHECK_NEAR(monitor.getCurrentUsage(), 2.5, 1e-9);
+}
+
+void testPowerSupplyVoltageCurrent() {
+    TempTree sys;
+    sys.write("class/power_supply/BAT0/voltage_now", "5000000\n");   // µV
+    sys.write("class/power_supply/BAT0/current_now", "-600000\n");   // µA, discharging
+    sys.mkdir("class/power_supply/AC");                               // no readings
+    PowerMonitor monitor(sys.root());
+    CHECK(monitor.sourceCount() == 1);
+    CHECK_NEAR(monitor.getCurrentUsage(), 3.0, 1e-9);
+}
+
+void testNoPowerSources() {
+    TempTree sys;
+    sys.mkdir("class/hwmon/hwmon0");
+    PowerMonitor monitor(sys.root());
+    CHECK(monitor.sourceCount() == 0);
+    CHECK_NEAR(monitor.getCurrentUsage(), 0.0, 1e-9);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testCpuJiffyDeltas);
+    RUN_TEST(testPressureStallPercent);
+    RUN_TEST(testCpuPressureThroughMonitor);
+    RUN_TEST(testMemoryAvailableUsage);
+    RUN_TEST(testHwmonEnergyToWatts);
+    RUN_TEST(testHwmonPowerInput);
+    RUN_TEST(testPowerSupplyVoltageCurrent);
+    RUN_TEST(testNoPowerSources);
+    return testResult();
+}
@@ -0,0 +1,70 @@
+// src/tools/log_decode.cpp
+// Prints binary logs written by Logger as text:
+//   log_decode data/sensor_logs/sensor_data.log [more.log ...]
+#include "utils/log_record.hpp"
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+static bool decodeFile(const char* path) {
+    FILE* file = std::fopen(path, "rb");
+    if (file == nullptr) {
+        std::fprintf(stderr, "log_decode: cannot open %s\n", path);
+        return false;
+    }
+
+    LogFileHeader fileHeader;
+    if (std::fread(&fileHeader, sizeof(fileHeader), 1, file) != 1 ||
+        std::memcmp(fileHeader.magic, kLogFileMagic, sizeof(fileHeader.magic)) != 0) {
+        std::fprintf(stderr, "log_decode: %s is not an ERA log\n", path);
+        std::fclose(file);
+        return false;
+    }
+    if (fileHeader.version != kLogFormatVersion ||
+        fileHeader.record_header_size != sizeof(LogRecordHeader)) {
+        std::fprintf(stderr, "log_decode: %s has unsupported format version %u\n",
+                     path, fileHeader.version);
+        std::fclose(file);
+        return false;
+    }
+
+    LogRecordHeader record;
+    char payload[65536];
+    bool ok = true;
+    while (std::fread(&record, sizeof(record), 1, file) == 1) {
+        if (std::fread(payload, 1, record.length, file) != record.length) {
+            std::fprintf(stderr, "log_decode: %s ends with a partial record\n", path);
+            ok = false;
+            break;
+        }
+
+        std::time_t seconds = static_cast<std::time_t>(record.timestamp_ns / 1000000000ull);
+        unsigned micros = static_cast<unsigned>((record.timestamp_ns % 1000000000ull) / 1000);
+        std::tm local;
+        localtime_r(&seconds, &local);
+        char stamp[32];
+        std::strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &local);
+
+        std::printf("%s.%06u [%u] %.*s%s\n", stamp, micros, record.thread_id,
+                    static_cast<int>(record.length), payload,
+                    (record.flags & kLogRecordTruncated) ? " [truncated]" : "");
+    }
+
+    std::fclose(file);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <log file>...\n", argv[0]);
+        return 2;
+    }
+
+    int status = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (!decodeFile(argv[i])) {
+            status = 1;
+        }
+    }
+    return status;
+}
@@ -0,0 +1,113 @@
+#include "utils/latency_histogram.hpp"
+#include <cmath>
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t bucket) {
+    if (bucket < kSubBuckets) {
+        return bucket;
+    }
+    unsigned shift = static_cast<unsigned>(bucket / kSubBuckets) - 1;
+    uint64_t lower = static_cast<uint64_t>(kSubBuckets + bucket % kSubBuckets) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
+
+uint64_t LatencyHistogram::percentile(double fraction) const {
+    uint64_t recorded = count();
+    if (recorded == 0) {
+        return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(recorded)));
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t largest = maximum.load(std::memory_order_relaxed);
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+        seen += counts[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            uint64_t value = bucketUpperBound(bucket);
+            return value < largest ? value : largest;
+        }
+    }
+    return largest;
+}
+
+LatencySummary LatencyHistogram::summarize() const {
+    LatencySummary summary;
+    summary.count = count();
+    if (summary.count == 0) {
+        return summary;
+    }
+    summary.min_ns = minimum.load(std::memory_order_relaxed);
+    summary.max_ns = maximum.load(std::memory_order_relaxed);
+    summary.mean_ns = static_cast<double>(sum.load(std::memory_order_relaxed)) /
+                      static_cast<double>(summary.count);
+    summary.p50_ns = percentile(0.50);
+    summary.p90_ns = percentile(0.90);
+    summary.p99_ns = percentile(0.99);
+    summary.p999_ns = percentile(0.999);
+    return summary;
+}
+
+LatencySummary LatencyHistogram::summarizeSince(Window& window) const {
+    uint64_t delta[kBucketCount];
+    LatencySummary summary;
+    size_t lowest = kBucketCount;
+    size_t highest = 0;
+    for (size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+        uint64_t now = counts[bucket].load(std::memory_order_relaxed);
+        delta[bucket] = now - window.counts[bucket];
+        window.counts[bucket] = now;
+        if (delta[bucket] != 0) {
+            lowest = lowest < bucket ? lowest : bucket;
+            highest = bucket;
+            summary.count += delta[bucket];
+        }
+    }
+    uint64_t sumNow = sum.load(std::memory_order_relaxed);
+    uint64_t sumDelta = sumNow - window.sum;
+    window.sum = sumNow;
+    if (summary.count == 0) {
+        return summary;
+    }
+
+    // The all-time extremes tighten the bucket bounds.
+    uint64_t floor = lowest == 0 ? 0 : bucketUpperBound(lowest - 1) + 1;
+    uint64_t smallest = minimum.load(std::memory_order_relaxed);
+    uint64_t largest = maximum.load(std::memory_order_relaxed);
+    uint64_t ceiling = bucketUpperBound(highest);
+    summary.min_ns = floor > smallest ? floor : smallest;
+    summary.max_ns = ceiling < largest ? ceiling : largest;
+    summary.mean_ns = static_cast<double>(sumDelta) / static_cast<double>(summary.count);
+
+    auto percentileOf = [&](double fraction) {
+        uint64_t rank = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(summary.count)));
+        if (rank == 0) {
+            rank = 1;
+        }
+        uint64_t seen = 0;
+        for (size_t bucket = lowest; bucket <= highest; ++bucket) {
+            seen += delta[bucket];
+            if (seen >= rank) {
+                uint64_t value = bucketUpperBound(bucket);
+                return value < summary.max_ns ? value : summary.max_ns;
+            }
+        }
+        return summary.max_ns;
+    };
+    summary.p50_ns = percentileOf(0.50);
+    summary.p90_ns = percentileOf(0.90);
+    summary.p99_ns = percentileOf(0.99);
+    summary.p999_ns = percentileOf(0.999);
+    return summary;
+}
+
+void LatencyHistogram::reset() {
+    for (std::atomic<uint64_t>& bucket : counts) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    maximum.store(0, std::memory_order_relaxed);
+    minimum.store(UINT64_MAX, std::memory_order_relaxed);
+}
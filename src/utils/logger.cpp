@@ -0,0 +1,371 @@
+#include "utils/logger.hpp"
+#include "utils/clock.hpp"
+#include "utils/log_record.hpp"
+#include "utils/mpsc_ring.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr size_t kRingCapacity = 1024;
+constexpr size_t kMaxSinks = 16;
+constexpr size_t kMaxBatch = 256;
+
+struct LogSlot {
+    LogRecordHeader header;
+    LogSinkId sink;
+    char payload[kLogPayloadCapacity];
+};
+
+struct Sink {
+    std::string path;
+    int fd = -1;
+    std::vector<iovec> iov;
+    size_t pending = 0;
+    bool dirty = false;
+    std::chrono::steady_clock::time_point last_sync;
+};
+
+uint32_t currentThreadId() {
+    thread_local uint32_t tid = static_cast<uint32_t>(::syscall(SYS_gettid));
+    return tid;
+}
+
+bool writeAll(int fd, iovec* iov, int count) {
+    while (count > 0) {
+        ssize_t written = ::writev(fd, iov, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        while (count > 0 && static_cast<size_t>(written) >= iov->iov_len) {
+            written -= static_cast<ssize_t>(iov->iov_len);
+            ++iov;
+            --count;
+        }
+        if (count > 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + written;
+            iov->iov_len -= static_cast<size_t>(written);
+        }
+    }
+    return true;
+}
+
+// Opens `path` for appending and makes sure it starts with a LogFileHeader.
+// Refuses files that exist but were not written by this logger.
+int openLogFile(const std::string& path) {
+    std::error_code ec;
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    if (!parent.empty()) {
+        std::filesystem::create_directories(parent, ec);
+    }
+
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return -1;
+    }
+
+    if (st.st_size == 0) {
+        LogFileHeader header{};
+        std::memcpy(header.magic, kLogFileMagic, sizeof(header.magic));
+        header.version = kLogFormatVersion;
+        header.record_header_size = sizeof(LogRecordHeader);
+        iovec iov{&header, sizeof(header)};
+        if (!writeAll(fd, &iov, 1)) {
+            ::close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    int check = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    char magic[sizeof(kLogFileMagic)] = {};
+    bool valid = check >= 0 &&
+                 ::pread(check, magic, sizeof(magic), 0) == static_cast<ssize_t>(sizeof(magic)) &&
+                 std::memcmp(magic, kLogFileMagic, sizeof(magic)) == 0;
+    if (check >= 0) {
+        ::close(check);
+    }
+    if (!valid) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+class LogWriter {
+public:
+    static LogWriter& instance() {
+        static LogWriter writer;
+        return writer;
+    }
+
+    LogSinkId findSink(const std::string& filename) const {
+        size_t count = sinkCount.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            if (sinks[i].path == filename) {
+                return static_cast<LogSinkId>(i);
+            }
+        }
+        return kInvalidLogSink;
+    }
+
+    LogSinkId openSink(const std::string& filename) {
+        std::lock_guard<std::mutex> lock(sinkMutex);
+        LogSinkId existing = findSink(filename);
+        if (existing != kInvalidLogSink) {
+            return existing;
+        }
+
+        size_t index = sinkCount.load(std::memory_order_relaxed);
+        if (index == kMaxSinks) {
+            return kInvalidLogSink;
+        }
+
+        int fd = openLogFile(filename);
+        if (fd < 0) {
+            return kInvalidLogSink;
+        }
+
+        Sink& sink = sinks[index];
+        sink.path = filename;
+        sink.fd = fd;
+        sink.iov.reserve(kMaxBatch * 2);
+        sink.last_sync = std::chrono::steady_clock::now();
+        sinkCount.store(index + 1, std::memory_order_release);
+        return static_cast<LogSinkId>(index);
+    }
+
+    bool push(LogSinkId sink, const char* data, size_t length) {
+        if (sink >= sinkCount.load(std::memory_order_acquire)) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        size_t copied = std::min(length, kLogPayloadCapacity);
+        uint16_t flags = copied < length ? kLogRecordTruncated : 0;
+        uint64_t timestamp = realtimeNs();
+        uint32_t tid = currentThreadId();
+
+        bool pushed = ring.tryPush([&](LogSlot& slot) {
+            slot.header.timestamp_ns = timestamp;
+            slot.header.thread_id = tid;
+            slot.header.length = static_cast<uint16_t>(copied);
+            slot.header.flags = flags;
+            slot.sink = sink;
+            std::memcpy(slot.payload, data, copied);
+        });
+        if (!pushed) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (ring.sizeApprox() == batchRecords.load(std::memory_order_relaxed)) {
+            wake.notify_one();
+        }
+        return true;
+    }
+
+    void setPolicy(const LogFlushPolicy& newPolicy) {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            policy = newPolicy;
+            batchRecords.store(std::max<size_t>(newPolicy.batch_records, 1), std::memory_order_relaxed);
+        }
+        wake.notify_one();
+    }
+
+    void flush() {
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        uint64_t target = ++flushRequested;
+        wake.notify_one();
+        flushed.wait(lock, [&] { return flushCompleted >= target; });
+    }
+
+    uint64_t dropped() const { return droppedCount.load(std::memory_order_relaxed); }
+
+    ~LogWriter() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        thread.join();
+
+        size_t count = sinkCount.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            if (sinks[i].dirty) {
+                ::fdatasync(sinks[i].fd);
+            }
+            ::close(sinks[i].fd);
+        }
+    }
+
+private:
+    LogWriter() : thread([this] { run(); }) {}
+
+    void run() {
+        for (;;) {
+            uint64_t flushTarget;
+            LogFlushPolicy current;
+            bool exiting;
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                wake.wait_for(lock, policy.max_delay, [&] {
+                    return stopping || flushRequested != flushCompleted ||
+                           ring.sizeApprox() >= batchRecords.load(std::memory_order_relaxed);
+                });
+                flushTarget = flushRequested;
+                current = policy;
+                exiting = stopping;
+            }
+
+            while (drainBatch() > 0) {
+            }
+            syncSinks(current);
+
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                flushCompleted = flushTarget;
+            }
+            flushed.notify_all();
+
+            if (exiting) {
+                return;
+            }
+        }
+    }
+
+    // Gathers up to kMaxBatch published records into one iovec list per sink
+    // and writes each list with a single writev(). Records are written from
+    // the ring slots directly and only released afterwards.
+    size_t drainBatch() {
+        size_t count = sinkCount.load(std::memory_order_acquire);
+        size_t taken = 0;
+        while (taken < kMaxBatch) {
+            const LogSlot* slot = ring.peek(taken);
+            if (slot == nullptr) {
+                break;
+            }
+            Sink& sink = sinks[slot->sink];
+            sink.iov.push_back({const_cast<LogRecordHeader*>(&slot->header), sizeof(LogRecordHeader)});
+            sink.iov.push_back({const_cast<char*>(slot->payload), slot->header.length});
+            ++sink.pending;
+            ++taken;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            Sink& sink = sinks[i];
+            if (sink.iov.empty()) {
+                continue;
+            }
+            // Only this thread appends to the file, so its size marks where
+            // the batch starts. A batch that fails partway is cut off again;
+            // a torn record would make every later one undecodable.
+            struct stat st;
+            bool sized = ::fstat(sink.fd, &st) == 0;
+            if (writeAll(sink.fd, sink.iov.data(), static_cast<int>(sink.iov.size()))) {
+                sink.dirty = true;
+            } else {
+                if (sized) {
+                    ::ftruncate(sink.fd, st.st_size);
+                }
+                droppedCount.fetch_add(sink.pending, std::memory_order_relaxed);
+            }
+            sink.iov.clear();
+            sink.pending = 0;
+        }
+
+        ring.release(taken);
+        return taken;
+    }
+
+    void syncSinks(const LogFlushPolicy& current) {
+        if (current.sync_interval.count() <= 0) {
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        size_t count = sinkCount.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            Sink& sink = sinks[i];
+            if (sink.dirty && now - sink.last_sync >= current.sync_interval) {
+                ::fdatasync(sink.fd);
+                sink.dirty = false;
+                sink.last_sync = now;
+            }
+        }
+    }
+
+    MpscRing<LogSlot, kRingCapacity> ring;
+    std::array<Sink, kMaxSinks> sinks;
+    std::atomic<size_t> sinkCount{0};
+    std::mutex sinkMutex;
+
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::condition_variable flushed;
+    LogFlushPolicy policy;
+    std::atomic<size_t> batchRecords{LogFlushPolicy{}.batch_records};
+    uint64_t flushRequested = 0;
+    uint64_t flushCompleted = 0;
+    bool stopping = false;
+
+    std::atomic<uint64_t> droppedCount{0};
+    std::thread thread;
+};
+
+} // namespace
+
+LogSinkId Logger::openSink(const std::string& filename) {
+    return LogWriter::instance().openSink(filename);
+}
+
+bool Logger::log(LogSinkId sink, const char* data, size_t length) {
+    return LogWriter::instance().push(sink, data, length);
+}
+
+bool Logger::log(LogSinkId sink, const std::string& message) {
+    return LogWriter::instance().push(sink, message.data(), message.size());
+}
+
+bool Logger::log(const std::string& filename, const std::string& message) {
+    LogWriter& writer = LogWriter::instance();
+    LogSinkId sink = writer.findSink(filename);
+    if (sink == kInvalidLogSink) {
+        sink = writer.openSink(filename);
+    }
+    return writer.push(sink, message.data(), message.size());
+}
+
+void Logger::setFlushPolicy(const LogFlushPolicy& policy) {
+    LogWriter::instance().setPolicy(policy);
+}
+
+void Logger::flush() {
+    LogWriter::instance().flush();
+}
+
+uint64_t Logger::droppedRecords() {
+    return LogWriter::instance().dropped();
+}
@@ -0,0 +1,151 @@
+#include "utils/metrics.hpp"
+#include "utils/clock.hpp"
+#include <cstdio>
+#include <deque>
+#include <fcntl.h>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Set during static initialisation, i.e. close to process start.
+const uint64_t processStartNs = monotonicNs();
+
+constexpr off_t kMaxSnapshotFileBytes = 1 << 20;
+
+class MetricsRegistry {
+public:
+    static MetricsRegistry& instance() {
+        static MetricsRegistry registry;
+        return registry;
+    }
+
+    LatencyHistogram& stage(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Stage& entry : stages) {
+            if (entry.name == name) {
+                return *entry.histogram;
+            }
+        }
+        stages.push_back({name, std::make_unique<LatencyHistogram>(),
+                          std::make_unique<LatencyHistogram::Window>()});
+        return *stages.back().histogram;
+    }
+
+    // With `windowed`, the stage summaries cover only what was recorded
+    // since the previous windowed snapshot.
+    std::string snapshotJson(bool windowed) {
+        rusage usage{};
+        ::getrusage(RUSAGE_SELF, &usage);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        uint64_t now = monotonicNs();
+        uint64_t windowStart = windowed ? lastWindowNs : processStartNs;
+        if (windowed) {
+            lastWindowNs = now;
+        }
+
+        char buffer[256];
+        std::snprintf(buffer, sizeof(buffer),
+                      "{\"timestamp_ns\":%llu,\"uptime_ns\":%llu,\"window_ns\":%llu,\"cpu_user_us\":%lld,"
+                      "\"cpu_system_us\":%lld,\"max_rss_kb\":%ld,\"stages\":{",
+                      static_cast<unsigned long long>(realtimeNs()),
+                      static_cast<unsigned long long>(now - processStartNs),
+                      static_cast<unsigned long long>(now - windowStart),
+                      static_cast<long long>(usage.ru_utime.tv_sec) * 1000000 + usage.ru_utime.tv_usec,
+                      static_cast<long long>(usage.ru_stime.tv_sec) * 1000000 + usage.ru_stime.tv_usec,
+                      usage.ru_maxrss);
+        std::string json = buffer;
+
+        bool first = true;
+        for (const Stage& entry : stages) {
+            LatencySummary s = windowed ? entry.histogram->summarizeSince(*entry.window)
+                                        : entry.histogram->summarize();
+            json += first ? "\"" : ",\"";
+            json += entry.name;
+            std::snprintf(buffer, sizeof(buffer),
+                          "\":{\"count\":%llu,\"min_ns\":%llu,\"mean_ns\":%.1f,\"p50_ns\":%llu,"
+                          "\"p90_ns\":%llu,\"p99_ns\":%llu,\"p999_ns\":%llu,\"max_ns\":%llu}",
+                          static_cast<unsigned long long>(s.count),
+                          static_cast<unsigned long long>(s.min_ns), s.mean_ns,
+                          static_cast<unsigned long long>(s.p50_ns),
+                          static_cast<unsigned long long>(s.p90_ns),
+                          static_cast<unsigned long long>(s.p99_ns),
+                          static_cast<unsigned long long>(s.p999_ns),
+                          static_cast<unsigned long long>(s.max_ns));
+            json += buffer;
+            first = false;
+        }
+        json += "}}\n";
+        return json;
+    }
+
+    bool append(const std::string& filename, const std::string& line) {
+        std::lock_guard<std::mutex> lock(fileMutex);
+        if (fd >= 0 && (filename != path || fileBytes >= kMaxSnapshotFileBytes)) {
+            ::close(fd);
+            fd = -1;
+            if (filename == path) {
+                std::rename(path.c_str(), (path + ".1").c_str());
+            }
+        }
+        if (fd < 0) {
+            std::error_code ec;
+            std::filesystem::path parent = std::filesystem::path(filename).parent_path();
+            if (!parent.empty()) {
+                std::filesystem::create_directories(parent, ec);
+            }
+            fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+            if (fd < 0) {
+                return false;
+            }
+            struct stat st{};
+            fileBytes = ::fstat(fd, &st) == 0 ? st.st_size : 0;
+            path = filename;
+        }
+
+        ssize_t written = ::write(fd, line.data(), line.size());
+        if (written > 0) {
+            fileBytes += written;
+        }
+        return written == static_cast<ssize_t>(line.size());
+    }
+
+private:
+    struct Stage {
+        std::string name;
+        std::unique_ptr<LatencyHistogram> histogram;
+        std::unique_ptr<LatencyHistogram::Window> window;
+    };
+
+    MetricsRegistry() = default;
+
+    std::mutex mutex;
+    // Histograms never move once registered.
+    std::deque<Stage> stages;
+    uint64_t lastWindowNs = processStartNs;
+
+    std::mutex fileMutex;
+    int fd = -1;
+    std::string path;
+    off_t fileBytes = 0;
+};
+
+} // namespace
+
+LatencyHistogram& Metrics::stage(const std::string& name) {
+    return MetricsRegistry::instance().stage(name);
+}
+
+std::string Metrics::snapshotJson() {
+    return MetricsRegistry::instance().snapshotJson(false);
+}
+
+bool Metrics::writeSnapshot(const std::string& filename) {
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    return registry.append(filename, registry.snapshotJson(true));
+}
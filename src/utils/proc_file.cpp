@@ -0,0 +1,115 @@
+#include "utils/proc_file.hpp"
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+ProcFile::ProcFile(const std::string& path)
+    : fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC)) {}
+
+ProcFile::~ProcFile() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+ProcFile::ProcFile(ProcFile&& other) noexcept : fd(other.fd) {
+    other.fd = -1;
+}
+
+ProcFile& ProcFile::operator=(ProcFile&& other) noexcept {
+    if (this != &other) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        fd = other.fd;
+        other.fd = -1;
+    }
+    return *this;
+}
+
+long ProcFile::read(char* buffer, size_t capacity) const {
+    if (fd < 0 || capacity == 0) {
+        return -1;
+    }
+    size_t total = 0;
+    while (total < capacity - 1) {
+        ssize_t n = ::pread(fd, buffer + total, capacity - 1 - total, static_cast<off_t>(total));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (n == 0) {
+            break;
+        }
+        total += static_cast<size_t>(n);
+    }
+    buffer[total] = '\0';
+    return static_cast<long>(total);
+}
+
+bool ProcFile::readInteger(int64_t& value) const {
+    char buffer[32];
+    if (read(buffer, sizeof(buffer)) <= 0) {
+        return false;
+    }
+    const char* p = skipSpaces(buffer);
+    bool negative = *p == '-';
+    if (negative) {
+        ++p;
+    }
+    uint64_t magnitude;
+    const char* end = parseUnsigned(p, magnitude);
+    if (end == p) {
+        return false;
+    }
+    value = negative ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude);
+    return true;
+}
+
+const char* skipSpaces(const char* p) {
+    while (*p == ' ' || *p == '\t') {
+        ++p;
+    }
+    return p;
+}
+
+const char* skipLine(const char* p) {
+    while (*p != '\0' && *p != '\n') {
+        ++p;
+    }
+    return *p == '\n' ? p + 1 : p;
+}
+
+const char* parseUnsigned(const char* p, uint64_t& value) {
+    p = skipSpaces(p);
+    value = 0;
+    while (*p >= '0' && *p <= '9') {
+        value = value * 10 + static_cast<uint64_t>(*p - '0');
+        ++p;
+    }
+    return p;
+}
+
+const char* parseDecimal(const char* p, double& value) {
+    uint64_t whole;
+    p = parseUnsigned(p, whole);
+    value = static_cast<double>(whole);
+    if (*p == '.') {
+        double scale = 0.1;
+        for (++p; *p >= '0' && *p <= '9'; ++p, scale *= 0.1) {
+            value += (*p - '0') * scale;
+        }
+    }
+    return p;
+}
+
+bool startsWith(const char* p, const char* prefix) {
+    while (*prefix != '\0') {
+        if (*p++ != *prefix++) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,103 @@
+#include "utils/sysfs_writer.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+void copyValue(char* dest, const char* value) {
+    size_t length = std::strlen(value);
+    if (length >= SysfsWriter::kValueCapacity) {
+        length = SysfsWriter::kValueCapacity - 1;
+    }
+    std::memcpy(dest, value, length);
+    dest[length] = '\0';
+}
+
+void readCurrent(int fd, char* dest) {
+    ssize_t n;
+    do {
+        n = ::pread(fd, dest, SysfsWriter::kValueCapacity - 1, 0);
+    } while (n < 0 && errno == EINTR);
+    size_t length = n > 0 ? static_cast<size_t>(n) : 0;
+    while (length > 0 && (dest[length - 1] == '\n' || dest[length - 1] == ' ')) {
+        --length;
+    }
+    dest[length] = '\0';
+}
+
+} // namespace
+
+SysfsWriter::~SysfsWriter() {
+    for (Attribute& attribute : attributes) {
+        ::close(attribute.fd);
+    }
+}
+
+int SysfsWriter::attach(const std::string& path) {
+    Attribute attribute{};
+    attribute.fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+    if (attribute.fd >= 0) {
+        readCurrent(attribute.fd, attribute.current);
+    } else {
+        attribute.fd = ::open(path.c_str(), O_WRONLY | O_CLOEXEC);
+        if (attribute.fd < 0) {
+            return -1;
+        }
+    }
+    // Plain files stand in for sysfs in tests; keep them holding one value.
+    struct stat info;
+    attribute.regular = ::fstat(attribute.fd, &info) == 0 && S_ISREG(info.st_mode);
+    attributes.push_back(attribute);
+    return static_cast<int>(attributes.size() - 1);
+}
+
+void SysfsWriter::stage(int attribute, const char* value) {
+    if (attribute < 0) {
+        return;
+    }
+    Attribute& target = attributes[attribute];
+    copyValue(target.staged, value);
+    target.pending = true;
+}
+
+void SysfsWriter::stage(int attribute, uint64_t value) {
+    char text[24];
+    std::snprintf(text, sizeof(text), "%llu", static_cast<unsigned long long>(value));
+    stage(attribute, text);
+}
+
+size_t SysfsWriter::commit() {
+    size_t failed = 0;
+    for (Attribute& attribute : attributes) {
+        if (!attribute.pending) {
+            continue;
+        }
+        attribute.pending = false;
+        if (std::strcmp(attribute.staged, attribute.current) == 0) {
+            ++skipped;
+            continue;
+        }
+
+        size_t length = std::strlen(attribute.staged);
+        ssize_t n;
+        do {
+            n = ::pwrite(attribute.fd, attribute.staged, length, 0);
+        } while (n < 0 && errno == EINTR);
+        if (n != static_cast<ssize_t>(length)) {
+            ++failed;
+            continue;
+        }
+        if (attribute.regular && ::ftruncate(attribute.fd, static_cast<off_t>(length)) != 0) {
+            ++failed;
+            continue;
+        }
+        std::memcpy(attribute.current, attribute.staged, length + 1);
+        ++writes;
+    }
+    failures += failed;
+    return failed;
+}
@@ -0,0 +1,82 @@
+#include "utils/worker_pool.hpp"
+#include <algorithm>
+
+WorkerPool::WorkerPool(unsigned threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i) {
+        workers.emplace_back([this] { workerLoop(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    start.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkerPool::run(size_t newCount, size_t newGrain, Task newTask, void* newContext) {
+    if (newCount == 0) {
+        return;
+    }
+    newGrain = std::max<size_t>(newGrain, 1);
+    if (workers.empty() || newCount <= newGrain) {
+        newTask(newContext, 0, newCount);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = newTask;
+        context = newContext;
+        count = newCount;
+        grain = newGrain;
+        next.store(0, std::memory_order_relaxed);
+        active = static_cast<unsigned>(workers.size());
+        ++generation;
+    }
+    start.notify_all();
+
+    work();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return active == 0; });
+}
+
+void WorkerPool::workerLoop() {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            start.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+
+        work();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--active == 0) {
+            done.notify_one();
+        }
+    }
+}
+
+void WorkerPool::work() {
+    for (;;) {
+        size_t begin = next.fetch_add(grain, std::memory_order_relaxed);
+        if (begin >= count) {
+            return;
+        }
+        task(context, begin, std::min(begin + grain, count));
+    }
+}